@@ -0,0 +1,112 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+/// Timing shared by the Glass benchmarks. A benchmark compares variants of
+/// the same work. compare() runs them interleaved for a number of rounds and
+/// rotates which one goes first, so no variant always gets the cold cache or
+/// the turbo boost, and reports the median round of each.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace bench {
+	/// Clock used for every measurement.
+	typedef std::chrono::steady_clock Clock;
+
+	///////////////////////////////////////////////////////////
+	/// struct Variant is one way of doing the measured work.
+	///////////////////////////////////////////////////////////
+	struct Variant {
+		/// Name printed with the result.
+		std::string name;
+		/// Does one round of the work. It is called every round so
+		/// it should keep its state between calls.
+		std::function<void()> run;
+	};
+
+	///////////////////////////////////////////////////////////
+	/// struct Result holds the timings of a Variant.
+	///////////////////////////////////////////////////////////
+	struct Result {
+		/// Name of the Variant.
+		std::string name;
+		/// Median nanoseconds per operation.
+		double median = 0.0;
+		/// Fastest round in nanoseconds per operation.
+		double fastest = 0.0;
+	};
+
+	/// Written by benchmarks so the compiler keeps the work.
+	inline volatile double sink = 0.0;
+
+	///////////////////////////////////////////////////////////
+	/// Function compare() will time every Variant. Each round
+	/// runs all of them once, starting with a different one.
+	/// One round is run first as a warm up.
+	/// @param const std::vector<Variant>& variants: Variants.
+	/// @param double operations: Operations in one round, to
+	///  report the time per operation.
+	/// @param size_t rounds: Number of timed rounds.
+	/// @returns std::vector<Result>: Result of every Variant.
+	///////////////////////////////////////////////////////////
+	inline std::vector<Result> compare(
+		const std::vector<Variant>& variants,
+		double operations,
+		size_t rounds = 15
+	) {
+		const size_t count = variants.size();
+		std::vector<std::vector<double>> times(count);
+
+		for (size_t round = 0; round <= rounds; round++) {
+			for (size_t i = 0; i < count; i++) {
+				const size_t index = (round + i) % count;
+
+				const Clock::time_point start = Clock::now();
+				variants[index].run();
+				const double nanoseconds = std::chrono::duration<double, std::nano>(
+					Clock::now() - start).count();
+
+				if (round > 0)
+					times[index].push_back(nanoseconds / operations);
+			}
+		}
+
+		std::vector<Result> results(count);
+		for (size_t i = 0; i < count; i++) {
+			std::vector<double>& roundTimes = times[i];
+			std::sort(roundTimes.begin(), roundTimes.end());
+
+			results[i].name = variants[i].name;
+			if (!roundTimes.empty()) {
+				results[i].median = roundTimes[roundTimes.size() / 2];
+				results[i].fastest = roundTimes.front();
+			}
+		}
+		return results;
+	}
+	///////////////////////////////////////////////////////////
+	/// Function print() will print the results of compare()
+	/// and how much faster each is than the first.
+	/// @param const std::string& title: What was measured.
+	/// @param const std::vector<Result>& results: Results.
+	///////////////////////////////////////////////////////////
+	inline void print(const std::string& title, const std::vector<Result>& results) {
+		std::cout << title << std::endl;
+
+		for (const Result& result : results) {
+			std::cout << "  " << std::left << std::setw(32) << result.name << std::right
+				<< std::fixed << std::setprecision(2)
+				<< std::setw(12) << result.median << " ns/op median"
+				<< std::setw(12) << result.fastest << " ns/op fastest";
+			if (&result != &results.front() && result.median > 0.0)
+				std::cout << std::setw(10) << results.front().median / result.median << "x";
+			std::cout << std::endl;
+		}
+	}
+}
\ No newline at end of file
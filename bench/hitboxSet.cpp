@@ -0,0 +1,94 @@
+///////////////////////////////////////////////////////////////////////////////
+/// Benchmark of gs::HitboxSet against looping over Hitbox::intersects(). The
+/// set is a 64 column grid of 4,096 cells like an inventory, every third one
+/// round. Point queries are timed with and without SIMD and against the
+/// loop, rectangle queries with and without SIMD.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <Glass/glass.hpp>
+
+#include "bench.hpp"
+
+namespace {
+	/// Cheap random values in [0, 1).
+	struct Random {
+		unsigned int seed = 1;
+
+		float operator()() {
+			seed = seed * 1664525u + 1013904223u;
+			return static_cast<float>(seed >> 8) / 16777216.0f;
+		}
+	};
+}
+
+int main() {
+	const size_t hitboxCount = 4096;
+	const size_t queryCount = 1000;
+	const size_t columns = 64;
+
+	gs::HitboxSet simd, scalar;
+	std::vector<gs::Hitbox> hitboxes;
+	scalar.setSimd(false);
+
+	for (size_t i = 0; i < hitboxCount; i++) {
+		const gs::Vec2f cell(static_cast<float>(i % columns) * 32.0f,
+			static_cast<float>(i / columns) * 32.0f);
+		gs::Hitbox hitbox(i % 3 == 0 ? gs::Hitbox::Shape::Circle : gs::Hitbox::Shape::Rectangle);
+
+		if (hitbox.shape == gs::Hitbox::Shape::Circle) {
+			hitbox.setRadius(14.0f);
+			hitbox.setCenter(cell + gs::Vec2f(16.0f, 16.0f));
+		}
+		else {
+			hitbox.setPosition(cell + gs::Vec2f(2.0f, 2.0f));
+			hitbox.setSize(28.0f, 28.0f);
+		}
+
+		hitboxes.push_back(hitbox);
+		simd.add(hitbox);
+		scalar.add(hitbox);
+	}
+
+	Random random;
+	const float width = columns * 32.0f;
+	const float height = static_cast<float>(hitboxCount / columns) * 32.0f;
+	std::vector<gs::Vec2f> points(queryCount);
+	std::vector<sf::FloatRect> rects(queryCount);
+	for (size_t i = 0; i < queryCount; i++) {
+		points[i] = gs::Vec2f(random() * width, random() * height);
+		rects[i] = sf::FloatRect(points[i], gs::Vec2f(random() * 96.0f, random() * 96.0f));
+	}
+
+	std::vector<std::uint64_t> mask;
+	auto queryPoints = [&](const gs::HitboxSet& set) {
+		for (const gs::Vec2f& point : points) {
+			set.intersectsMask(point, mask);
+			bench::sink = bench::sink + mask[0];
+		}
+	};
+	auto queryRects = [&](const gs::HitboxSet& set) {
+		for (const sf::FloatRect& rect : rects) {
+			set.intersectsMask(rect, mask);
+			bench::sink = bench::sink + mask[0];
+		}
+	};
+
+	bench::print("Point query of 4,096 Hitboxes:", bench::compare({
+		{ "Hitbox::intersects() loop", [&]() {
+			for (const gs::Vec2f& point : points)
+				for (const gs::Hitbox& hitbox : hitboxes)
+					if (hitbox.intersects(point))
+						bench::sink = bench::sink + 1;
+		} },
+		{ "HitboxSet scalar", [&]() { queryPoints(scalar); } },
+		{ std::string("HitboxSet ") + gs::HitboxSet::getInstructionSet(),
+			[&]() { queryPoints(simd); } }
+	}, queryCount));
+
+	bench::print("Rectangle query of 4,096 Hitboxes:", bench::compare({
+		{ "HitboxSet scalar", [&]() { queryRects(scalar); } },
+		{ std::string("HitboxSet ") + gs::HitboxSet::getInstructionSet(),
+			[&]() { queryRects(simd); } }
+	}, queryCount));
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+///////////////////////////////////////////////////////////////////////////////
+/// Benchmark of 1,000 gs::RoundedButtons running their hover animation,
+/// updated and rendered every frame. The baseline is the same Button drawn
+/// with priv::RoundedRectangleShape, which computes every corner point with
+/// trig whenever the size changes.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <memory>
+
+#include <Glass/glass.hpp>
+
+#include "bench.hpp"
+
+namespace {
+	///////////////////////////////////////////////////////////
+	/// class UncachedRoundedButton is a RoundedButton drawn
+	/// with priv::RoundedRectangleShape.
+	///////////////////////////////////////////////////////////
+	class UncachedRoundedButton : public gs::Button {
+	public:
+		virtual void update() override {
+			Button::update();
+			syncShape();
+		}
+		virtual void render(sf::RenderTarget* target,
+			sf::RenderStates renderStates = sf::RenderStates::Default) override {
+			syncShape();
+			target->draw(roundedShape, renderStates);
+		}
+	protected:
+		gs::priv::RoundedRectangleShape roundedShape
+			= gs::priv::RoundedRectangleShape(gs::Vec2f(), 8.0f, 8);
+
+		/// Same as RoundedButton::syncShape().
+		void syncShape() {
+			const gs::Vec2f size = virtualHitbox.getSize();
+			const float radius = std::min(8.0f, std::min(size.x, size.y) / 2.0f);
+
+			if (radius != roundedShape.getCornersRadius())
+				roundedShape.setCornersRadius(radius);
+			if (size != roundedShape.getSize())
+				roundedShape.setSize(size);
+			roundedShape.setPosition(virtualHitbox.getPosition());
+			roundedShape.setFillColor(currentColor);
+			roundedShape.setOutlineThickness(outlineThickness);
+			roundedShape.setOutlineColor(outlineColor);
+		}
+	};
+
+	///////////////////////////////////////////////////////////
+	/// struct Scene is 1,000 Buttons on top of each other and
+	/// the frame they are on.
+	///////////////////////////////////////////////////////////
+	template <typename ButtonType>
+	struct Scene {
+		std::vector<std::unique_ptr<ButtonType>> buttons;
+		size_t frame = 0;
+
+		explicit Scene(size_t count) {
+			for (size_t i = 0; i < count; i++) {
+				buttons.emplace_back(new ButtonType());
+				ButtonType& button = *buttons.back();
+				button.setSize(200.0f, 60.0f);
+				button.setCenter(400.0f, 300.0f);
+				button.setSelectedScaleModifier(1.1f);
+				button.setSizeAdjustSpeed(5.0f);
+			}
+		}
+
+		/// Updates and renders frames. The mouse moves on and off
+		/// the Buttons every 30 frames, so they always animate.
+		void run(sf::RenderTarget& target, size_t frames) {
+			for (size_t i = 0; i < frames; i++, frame++) {
+				gs::input::mousePosition = (frame / 30) % 2 == 0
+					? gs::Vec2f(400.0f, 300.0f) : gs::Vec2f(-100.0f, -100.0f);
+
+				target.clear();
+				for (std::unique_ptr<ButtonType>& button : buttons) {
+					button->update();
+					button->render(&target);
+				}
+			}
+		}
+	};
+}
+
+int main() {
+	const size_t buttonCount = 1000;
+	const size_t frames = 60;
+
+	sf::RenderTexture target;
+	if (!target.create(800, 600)) {
+		std::cout << "Couldn't create the render texture." << std::endl;
+		return 1;
+	}
+
+	Scene<UncachedRoundedButton> uncached(buttonCount);
+	Scene<gs::RoundedButton> cached(buttonCount);
+
+	const std::vector<bench::Result> results = bench::compare({
+		{ "RoundedRectangleShape", [&]() { uncached.run(target, frames); target.display(); } },
+		{ "RoundedButton", [&]() { cached.run(target, frames); target.display(); } }
+	}, static_cast<double>(frames));
+
+	bench::print("Update and render of 1,000 animating rounded Buttons per frame:", results);
+	return 0;
+}
\ No newline at end of file
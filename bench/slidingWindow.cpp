@@ -0,0 +1,61 @@
+///////////////////////////////////////////////////////////////////////////////
+/// Benchmark of gs::util::SlidingWindowMinMax against scanning the whole
+/// window after every value, which is what auto adjusting Graph bounds cost
+/// without it. The window holds 100,000 values.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <Glass/glass.hpp>
+
+#include "bench.hpp"
+
+namespace {
+	/// Cheap random values in [0, 1).
+	struct Random {
+		unsigned int seed = 1;
+
+		float operator()() {
+			seed = seed * 1664525u + 1013904223u;
+			return static_cast<float>(seed >> 8) / 16777216.0f;
+		}
+	};
+}
+
+int main() {
+	const size_t windowSize = 100000;
+	const size_t valueCount = 2000;
+
+	Random random;
+	gs::util::RingBuffer<float> window(windowSize);
+	gs::util::SlidingWindowMinMax<float> extrema(windowSize);
+
+	// Both run on a full window.
+	for (size_t i = 0; i < windowSize; i++) {
+		const float value = random();
+		window.push(value);
+		extrema.push(value);
+	}
+
+	const std::vector<bench::Result> results = bench::compare({
+		{ "full scan", [&]() {
+			for (size_t i = 0; i < valueCount; i++) {
+				window.push(random());
+
+				float minimum = window[0], maximum = window[0];
+				for (size_t j = 1; j < window.size(); j++) {
+					minimum = window[j] < minimum ? window[j] : minimum;
+					maximum = window[j] > maximum ? window[j] : maximum;
+				}
+				bench::sink = minimum + maximum;
+			}
+		} },
+		{ "SlidingWindowMinMax", [&]() {
+			for (size_t i = 0; i < valueCount; i++) {
+				extrema.push(random());
+				bench::sink = extrema.getMin() + extrema.getMax();
+			}
+		} }
+	}, valueCount);
+
+	bench::print("Window min and max per value, 100k values:", results);
+	return 0;
+}
\ No newline at end of file
@@ -32,21 +32,52 @@
 #include "hdr/util/state.hpp"
 #include "hdr/util/output.hpp"
 #include "hdr/util/clock.hpp"
+#include "hdr/util/ringBuffer.hpp"
+#include "hdr/util/slidingWindow.hpp"
+#include "hdr/util/minMaxPyramid.hpp"
+#include "hdr/util/concurrentQueue.hpp"
+#include "hdr/util/profiler.hpp"
+#include "hdr/util/frameTimeHistogram.hpp"
+#include "hdr/util/precisionClock.hpp"
+#include "hdr/util/spatialGrid.hpp"
+#include "hdr/util/gapBuffer.hpp"
+#include "hdr/util/textDocument.hpp"
+#include "hdr/util/approachBatch.hpp"
 #include "hdr/input/mouse.hpp"
 #include "hdr/input/key.hpp"
+#include "hdr/input/eventQueue.hpp"
+#include "hdr/input/inputContext.hpp"
+#include "hdr/input/inputRecorder.hpp"
 #include "hdr/hitbox.hpp"
+#include "hdr/hitboxSet.hpp"
 #include "hdr/component.hpp"
 #include "hdr/style.hpp"
 #include "hdr/text.hpp"
 #include "hdr/sprite.hpp"
 #include "hdr/roundedRectangle.hpp"
+#include "hdr/cachedRoundedRectangle.hpp"
 #include "hdr/button.hpp"
+#include "hdr/animatedButton.hpp"
+#include "hdr/roundedButton.hpp"
 #include "hdr/checkbox.hpp"
 #include "hdr/textbox.hpp"
+#include "hdr/bufferedTextbox.hpp"
+#include "hdr/textEditor.hpp"
 #include "hdr/slider.hpp"
 #include "hdr/graph.hpp"
+#include "hdr/polyline.hpp"
+#include "hdr/liveGraph.hpp"
 #include "hdr/menu.hpp"
+#include "hdr/util/fixedTimestep.hpp"
+#include "hdr/util/animator.hpp"
+#include "hdr/util/easing.hpp"
+#include "hdr/timeline.hpp"
 #include "hdr/transition.hpp"
+#include "hdr/shaderTransition.hpp"
+#include "hdr/batchRenderer.hpp"
+#include "hdr/redrawTracker.hpp"
+#include "hdr/hitTestMenu.hpp"
+#include "hdr/sdfShape.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
 /// #include <Glass/glass.hpp>
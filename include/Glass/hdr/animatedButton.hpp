@@ -0,0 +1,159 @@
+#pragma once
+
+// Dependencies
+#include <cmath>
+#include <cstdint>
+#include <initializer_list>
+
+#include "button.hpp"
+#include "util/animator.hpp"
+
+namespace gs {
+	///////////////////////////////////////////////////////////
+	/// class AnimatedButton is a Button whose color and scale
+	/// are animated by a util::Animator instead of every
+	/// update(). update() only checks whether anything the
+	/// color and scale depend on changed, such as being
+	/// selected, clicked, moved or restyled, and wakes the
+	/// Button in the Animator if it did. The Animator then
+	/// advances it every frame until the color and scale stop
+	/// changing. Idle AnimatedButtons never run the color and
+	/// scale animation. Call update() on the Animator every
+	/// frame after the Buttons.
+	///////////////////////////////////////////////////////////
+	class AnimatedButton : public Button, public util::Animator::Animation {
+	public:
+		///////////////////////////////////////////////////////////
+		/// @param util::Animator& animator: Animator that advances
+		///  the Button. It must outlive the Button.
+		///////////////////////////////////////////////////////////
+		explicit AnimatedButton(util::Animator& animator);
+		~AnimatedButton();
+
+		///////////////////////////////////////////////////////////
+		/// Method advance() will move the color and scale one
+		/// frame. It is called by the Animator.
+		/// @returns bool: False once the color and scale settled.
+		///////////////////////////////////////////////////////////
+		virtual bool advance() override;
+		///////////////////////////////////////////////////////////
+		/// Method setAnimator() will move the Button to another
+		/// Animator.
+		/// @param util::Animator& animator: New Animator.
+		///////////////////////////////////////////////////////////
+		virtual void setAnimator(util::Animator& animator);
+
+		///////////////////////////////////////////////////////////
+		/// @returns util::Animator&: Animator of the Button.
+		///////////////////////////////////////////////////////////
+		virtual util::Animator& getAnimator() const;
+		///////////////////////////////////////////////////////////
+		/// @returns bool: True if the Button is being animated.
+		///////////////////////////////////////////////////////////
+		virtual bool isAnimating() const;
+	protected:
+		/// Smallest change of a scale modifier that still counts
+		/// as moving.
+		static constexpr float scaleThreshold = 0.0001f;
+
+		/// Animator that advances the Button.
+		util::Animator* animator;
+		/// Fingerprint of what the color and scale depend on.
+		std::uint64_t inputs = 0;
+		/// Argument of the last updateColorAndScale() call.
+		bool customButton = false;
+
+		///////////////////////////////////////////////////////////
+		/// Method updateColorAndScale() will wake the Button if
+		/// its color or scale targets changed instead of moving
+		/// them.
+		/// @param bool customButton: Used for other Glass classes.
+		///////////////////////////////////////////////////////////
+		virtual void updateColorAndScale(bool customButton = false) override;
+		///////////////////////////////////////////////////////////
+		/// @returns std::uint64_t: Fingerprint of the state the
+		///  color and scale move toward.
+		///////////////////////////////////////////////////////////
+		virtual std::uint64_t fingerprint() const;
+	};
+
+	///////////////////////////////////////////////////////////
+	/// AnimatedButton
+	///////////////////////////////////////////////////////////
+
+	inline AnimatedButton::AnimatedButton(util::Animator& animator)
+		: animator(&animator) {
+	}
+	inline AnimatedButton::~AnimatedButton() {
+		animator->stop(static_cast<Animation*>(this));
+	}
+
+	inline bool AnimatedButton::advance() {
+		const Color color = currentColor, textColor = currentTextColor;
+		const float scale = currentScaleModifier, textScale = currentTextScaleModifier;
+
+		Button::updateColorAndScale(customButton);
+
+		return color != currentColor || textColor != currentTextColor
+			|| std::fabs(scale - currentScaleModifier) > scaleThreshold
+			|| std::fabs(textScale - currentTextScaleModifier) > scaleThreshold;
+	}
+	inline void AnimatedButton::setAnimator(util::Animator& animator) {
+		const bool awake = isAnimating();
+		this->animator->stop(static_cast<Animation*>(this));
+		this->animator = &animator;
+		if (awake)
+			animator.wake(*this);
+	}
+
+	inline util::Animator& AnimatedButton::getAnimator() const {
+		return *animator;
+	}
+	inline bool AnimatedButton::isAnimating() const {
+		return animator->isAnimating(static_cast<const Animation*>(this));
+	}
+
+	inline void AnimatedButton::updateColorAndScale(bool customButton) {
+		const std::uint64_t current = fingerprint();
+		if (current == inputs && this->customButton == customButton)
+			return;
+
+		inputs = current;
+		this->customButton = customButton;
+		animator->wake(*this);
+	}
+	inline std::uint64_t AnimatedButton::fingerprint() const {
+		std::uint64_t hash = 14695981039346656037ull;
+
+		auto add = [&hash](const void* data, size_t size) {
+			const unsigned char* bytes = static_cast<const unsigned char*>(data);
+			for (size_t i = 0; i < size; i++) {
+				hash ^= bytes[i];
+				hash *= 1099511628211ull;
+			}
+		};
+		auto addFloat = [&add](float value) { add(&value, sizeof(value)); };
+		auto addColor = [&add](Color color) {
+			const sf::Uint8 channels[4] = { color.r, color.g, color.b, color.a };
+			add(channels, sizeof(channels));
+		};
+
+		const bool flags[2] = { isSelected, isClickedOn };
+		const int events[2] = { static_cast<int>(eventSelected), static_cast<int>(eventClicked) };
+		add(flags, sizeof(flags));
+		add(events, sizeof(events));
+
+		const Vec2f position = hitbox.getPosition(), size = hitbox.getSize();
+		for (float value : { position.x, position.y, size.x, size.y, outlineThickness,
+			textOutlineThickness, selectedScaleModifier, selectedTextScaleModifier,
+			clickedScaleModifier, clickedTextScaleModifier, sizeAdjustSpeed,
+			colorAdjustSpeed, textScale.x, textScale.y, textOffset.x, textOffset.y })
+			addFloat(value);
+
+		for (Color color : { inActiveFillColor, inActiveTextFillColor, selectedFillColor,
+			selectedTextFillColor, clickedFillColor, clickedTextFillColor, outlineColor,
+			outlineTextColor })
+			addColor(color);
+		return hash;
+	}
+}
\ No newline at end of file
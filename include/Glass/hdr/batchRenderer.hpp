@@ -0,0 +1,684 @@
+#pragma once
+
+// Dependencies
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "menu.hpp"
+#include "cachedRoundedRectangle.hpp"
+#include "roundedButton.hpp"
+#include "textbox.hpp"
+#include "buttonAccess.hpp"
+#include "util/profiler.hpp"
+
+namespace gs {
+	namespace priv {
+		///////////////////////////////////////////////////////////
+		/// Function appendShape() will triangulate a convex shape
+		/// the same way sf::Shape does and append it to a vertex
+		/// array.
+		/// @param sf::VertexArray& vertices: Triangles to append to.
+		/// @param const Vec2f* points: Points along the edge.
+		/// @param size_t count: Number of points.
+		/// @param const sf::Transform& transform: Transform applied
+		///  to every point.
+		/// @param Color fillColor: Fill color.
+		/// @param float outlineThickness: Outline thickness.
+		/// @param Color outlineColor: Outline color.
+		/// @returns size_t: Number of draw calls sf::Shape would
+		///  have needed for the same shape.
+		///////////////////////////////////////////////////////////
+		inline size_t appendShape(
+			sf::VertexArray& vertices, const Vec2f* points, size_t count,
+			const sf::Transform& transform, Color fillColor,
+			float outlineThickness, Color outlineColor
+		) {
+			if (count < 3)
+				return 0;
+
+			Vec2f center;
+			for (size_t i = 0; i < count; i++)
+				center += points[i];
+			center /= static_cast<float>(count);
+
+			const Vec2f worldCenter = transform.transformPoint(center);
+			for (size_t i = 0; i < count && fillColor.a != 0; i++) {
+				const size_t next = (i + 1) % count;
+				vertices.append(sf::Vertex(worldCenter, fillColor));
+				vertices.append(sf::Vertex(
+					transform.transformPoint(points[i]), fillColor));
+				vertices.append(sf::Vertex(
+					transform.transformPoint(points[next]), fillColor));
+			}
+
+			if (outlineThickness == 0.0f)
+				return 1;
+
+			// Matches sf::Shape::updateOutline().
+			auto normalOf = [](Vec2f p1, Vec2f p2) {
+				Vec2f normal(p1.y - p2.y, p2.x - p1.x);
+				const float length = std::sqrt(
+					normal.x * normal.x + normal.y * normal.y);
+				return length != 0.0f ? normal / length : normal;
+			};
+			auto outerPoint = [&](size_t index) {
+				const Vec2f p0 = points[(index + count - 1) % count];
+				const Vec2f p1 = points[index];
+				const Vec2f p2 = points[(index + 1) % count];
+				Vec2f n1 = normalOf(p0, p1), n2 = normalOf(p1, p2);
+				const Vec2f toCenter = center - p1;
+
+				if (n1.x * toCenter.x + n1.y * toCenter.y > 0.0f)
+					n1 = -n1;
+				if (n2.x * toCenter.x + n2.y * toCenter.y > 0.0f)
+					n2 = -n2;
+
+				const float factor = 1.0f + (n1.x * n2.x + n1.y * n2.y);
+				return p1 + (n1 + n2) / factor * outlineThickness;
+			};
+
+			Vec2f inner = transform.transformPoint(points[0]);
+			Vec2f outer = transform.transformPoint(outerPoint(0));
+			const Vec2f firstInner = inner, firstOuter = outer;
+
+			for (size_t i = 1; i <= count; i++) {
+				const Vec2f nextInner = i == count ? firstInner
+					: transform.transformPoint(points[i]);
+				const Vec2f nextOuter = i == count ? firstOuter
+					: transform.transformPoint(outerPoint(i));
+
+				vertices.append(sf::Vertex(inner, outlineColor));
+				vertices.append(sf::Vertex(outer, outlineColor));
+				vertices.append(sf::Vertex(nextInner, outlineColor));
+				vertices.append(sf::Vertex(nextInner, outlineColor));
+				vertices.append(sf::Vertex(outer, outlineColor));
+				vertices.append(sf::Vertex(nextOuter, outlineColor));
+
+				inner = nextInner;
+				outer = nextOuter;
+			}
+
+			return 2;
+		}
+	}
+
+	///////////////////////////////////////////////////////////
+	/// class BatchRenderer collects the geometry of Components
+	/// and draws it with as few draw calls as possible. All
+	/// untextured shapes share one vertex array and textured
+	/// shapes get one vertex array per texture. Components that
+	/// can't be batched, such as Text, are drawn in between so
+	/// that the final image keeps the same z-order.
+	///////////////////////////////////////////////////////////
+	class BatchRenderer {
+	public:
+		BatchRenderer() = default;
+		~BatchRenderer() = default;
+
+		///////////////////////////////////////////////////////////
+		/// Method begin() will start collecting geometry for a new
+		/// frame. Note: Call end() to draw everything collected.
+		/// @param sf::RenderTarget* target: Pointer to the target
+		///  you want to render. Example: &window.
+		/// @param sf::RenderStates: Used for advanced blending and
+		///  custom shaders. By default it is set to
+		///  sf::RenderStates::Default.
+		///////////////////////////////////////////////////////////
+		void begin(
+			sf::RenderTarget* target,
+			sf::RenderStates renderStates = sf::RenderStates::Default
+		);
+		///////////////////////////////////////////////////////////
+		/// Method add() will add a Component to the current frame.
+		/// Menus are added recursively.
+		/// @param Component& component: Component to render.
+		///////////////////////////////////////////////////////////
+		void add(Component& component);
+		///////////////////////////////////////////////////////////
+		/// Method end() will draw everything added since begin()
+		/// in the order it was added.
+		///////////////////////////////////////////////////////////
+		void end();
+		///////////////////////////////////////////////////////////
+		/// Method render() will render all of the Components in a
+		/// Menu using batching. This is the same as calling
+		/// begin(), add() and end().
+		/// @param sf::RenderTarget* target: Pointer to the target
+		///  you want to render. Example: &window.
+		/// @param Menu& menu: Menu to render.
+		/// @param sf::RenderStates: Used for advanced blending and
+		///  custom shaders. By default it is set to
+		///  sf::RenderStates::Default.
+		///////////////////////////////////////////////////////////
+		void render(
+			sf::RenderTarget* target,
+			Menu& menu,
+			sf::RenderStates renderStates = sf::RenderStates::Default
+		);
+
+		///////////////////////////////////////////////////////////
+		/// @returns size_t: Number of draw calls made by the last
+		///  end() call.
+		///////////////////////////////////////////////////////////
+		size_t getDrawCalls() const;
+		///////////////////////////////////////////////////////////
+		/// @returns size_t: Number of draw calls the last end()
+		///  call saved compared to rendering each Component on its
+		///  own.
+		///////////////////////////////////////////////////////////
+		size_t getDrawCallsSaved() const;
+	protected:
+		///////////////////////////////////////////////////////////
+		/// struct Batch is a private struct used to store either a
+		/// run of geometry sharing a texture or a single Component
+		/// that has to be rendered on its own.
+		///////////////////////////////////////////////////////////
+		struct Batch {
+			/// Texture of the geometry or nullptr if untextured.
+			const sf::Texture* texture = nullptr;
+			/// Component to render directly instead of geometry.
+			Component* component = nullptr;
+			/// Index into the vertex array pool.
+			size_t vertexIndex = 0;
+			/// Area covered by everything in the batch.
+			sf::FloatRect bounds;
+		};
+
+		/// Target that is currently being rendered to.
+		sf::RenderTarget* target = nullptr;
+		/// States used for the current frame.
+		sf::RenderStates renderStates;
+		/// Batches of the current frame in z-order.
+		vector<Batch> batches;
+		/// Vertex arrays reused every frame to avoid allocations.
+		vector<sf::VertexArray> vertexPool;
+		/// Number of vertex arrays in use this frame.
+		size_t vertexPoolUsed = 0;
+		/// Draw calls that would be made without batching.
+		size_t unbatchedDrawCalls = 0;
+		/// Draw calls made by the last end() call.
+		size_t drawCalls = 0;
+		/// Draw calls saved by the last end() call.
+		size_t drawCallsSaved = 0;
+
+		///////////////////////////////////////////////////////////
+		/// Method getBatch() will find the batch new geometry with
+		/// a texture should be added to. Geometry can only join an
+		/// earlier batch if nothing drawn after it overlaps.
+		/// @param const sf::Texture* texture: Texture or nullptr.
+		/// @param const sf::FloatRect& bounds: Area of geometry.
+		/// @returns sf::VertexArray&: Vertex array to append to.
+		///////////////////////////////////////////////////////////
+		sf::VertexArray& getBatch(
+			const sf::Texture* texture, const sf::FloatRect& bounds);
+		///////////////////////////////////////////////////////////
+		/// Method addDirect() will add a Component that renders
+		/// itself.
+		/// @param Component& component: Component to render.
+		/// @param size_t drawCalls: Draw calls it would make.
+		///////////////////////////////////////////////////////////
+		void addDirect(Component& component, size_t drawCalls);
+		///////////////////////////////////////////////////////////
+		/// Method addGeometry() will append an untextured shape to
+		/// the batch it belongs to.
+		/// @param const Vec2f* points: Points along the edge.
+		/// @param size_t count: Number of points.
+		/// @param const sf::Transform& transform: Local transform.
+		/// @param Color fillColor: Fill color.
+		/// @param float outlineThickness: Outline thickness.
+		/// @param Color outlineColor: Outline color.
+		///////////////////////////////////////////////////////////
+		void addGeometry(
+			const Vec2f* points, size_t count,
+			const sf::Transform& transform, Color fillColor,
+			float outlineThickness, Color outlineColor
+		);
+		///////////////////////////////////////////////////////////
+		/// Method addSprite() will append a textured quad.
+		/// @param const sf::Sprite& sprite: Sprite to append.
+		///////////////////////////////////////////////////////////
+		void addSprite(const sf::Sprite& sprite);
+
+		///////////////////////////////////////////////////////////
+		/// @returns sf::FloatRect: Bounds of a Hitbox grown by a
+		///  margin on every side.
+		///////////////////////////////////////////////////////////
+		static sf::FloatRect boundsOf(const Hitbox& hitbox, float margin);
+	};
+
+	///////////////////////////////////////////////////////////
+	/// class BatchedMenu is a Menu that can be opted into
+	/// batched rendering. With batching enabled all of its
+	/// Components are drawn through a BatchRenderer. Its update
+	/// and render, and those of each Component, are recorded as
+	/// util::Profiler zones.
+	///////////////////////////////////////////////////////////
+	class BatchedMenu : public Menu {
+	public:
+		BatchedMenu() = default;
+		~BatchedMenu() = default;
+
+		///////////////////////////////////////////////////////////
+		/// Method update() will update all of the Components that
+		/// have been added to this Menu unless it is locked.
+		///////////////////////////////////////////////////////////
+		virtual void update() override;
+		///////////////////////////////////////////////////////////
+		/// Method render() will render the Menu object to a
+		/// sf::RenderTarget. If batching is enabled the Components
+		/// are batched together.
+		/// @param sf::RenderTarget* target: Pointer to the target
+		///  you want to render. Example: &window.
+		/// @param sf::RenderStates: Used for advanced blending and
+		///  custom shaders. By default it is set to
+		///  sf::RenderStates::Default.
+		///////////////////////////////////////////////////////////
+		virtual void render(
+			sf::RenderTarget* target,
+			sf::RenderStates renderStates = sf::RenderStates::Default
+		) override;
+
+		///////////////////////////////////////////////////////////
+		/// Method setBatching() will enable or disable batched
+		/// rendering. By default it is enabled.
+		/// @param bool enabled: True to enable batching.
+		///////////////////////////////////////////////////////////
+		virtual void setBatching(bool enabled);
+
+		///////////////////////////////////////////////////////////
+		/// @returns bool: True if batching is enabled.
+		///////////////////////////////////////////////////////////
+		virtual bool getBatching() const;
+		///////////////////////////////////////////////////////////
+		/// @returns size_t: Draw calls saved by the last render()
+		///  call.
+		///////////////////////////////////////////////////////////
+		virtual size_t getDrawCallsSaved() const;
+	protected:
+		/// Renderer used when batching is enabled.
+		BatchRenderer batchRenderer;
+		/// True if the Menu should batch rendering.
+		bool batching = true;
+	};
+
+	///////////////////////////////////////////////////////////
+	/// BatchRenderer
+	///////////////////////////////////////////////////////////
+
+	inline void BatchRenderer::begin(
+		sf::RenderTarget* target, sf::RenderStates renderStates
+	) {
+		this->target = target;
+		this->renderStates = renderStates;
+		batches.clear();
+		vertexPoolUsed = 0;
+		unbatchedDrawCalls = 0;
+	}
+	inline void BatchRenderer::add(Component& component) {
+		if (Menu* menu = dynamic_cast<Menu*>(&component)) {
+			GLASS_PROFILE_ZONE("BatchRenderer::add Menu");
+			for (Menu::ComponentContainer& container : menu->components)
+				if (container.ptr != nullptr)
+					add(*container.ptr);
+		}
+		else if (RoundedRectangle* rect
+			= dynamic_cast<RoundedRectangle*>(&component)) {
+			GLASS_PROFILE_ZONE("BatchRenderer::add RoundedRectangle");
+			const priv::RoundedRectangleShape& shape = rect->getInternalShape();
+			const size_t count = shape.getPointCount();
+			Vec2f points[256];
+
+			if (count > 256) {
+				addDirect(component, 2);
+				return;
+			}
+			priv::tessellateRoundedRectangle(
+				points, shape.getSize(), shape.getCornersRadius(),
+				static_cast<unsigned int>(count / 4)
+			);
+
+			addGeometry(
+				points, count, shape.getTransform(), shape.getFillColor(),
+				shape.getOutlineThickness(), shape.getOutlineColor()
+			);
+		}
+		else if (dynamic_cast<RoundedButton*>(&component) != nullptr
+			&& static_cast<RoundedButton&>(component).isRounded()) {
+			GLASS_PROFILE_ZONE("BatchRenderer::add RoundedButton");
+			RoundedButton& button = static_cast<RoundedButton&>(component);
+			button.syncShape();
+			const priv::CachedRoundedRectangleShape& shape = button.getInternalShape();
+			const size_t count = shape.getPointCount();
+			Vec2f points[256];
+
+			if (count > 256) {
+				addDirect(component, 2);
+				return;
+			}
+			priv::tessellateRoundedRectangle(
+				points, shape.getSize(), shape.getCornersRadius(),
+				shape.getCornerPointCount()
+			);
+
+			addGeometry(
+				points, count, shape.getTransform(), shape.getFillColor(),
+				shape.getOutlineThickness(), shape.getOutlineColor()
+			);
+			if (!button.getString().empty())
+				addDirect(priv::ButtonAccess::getText(button),
+					button.textHasShadow() ? 2 : 1);
+		}
+		else if (dynamic_cast<Textbox*>(&component) != nullptr)
+			// Textbox draws a cursor so it can't be reproduced.
+			addDirect(component, 3);
+		else if (Button* button = dynamic_cast<Button*>(&component)) {
+			GLASS_PROFILE_ZONE("BatchRenderer::add Button");
+			if (button->renderMethod != Button::RenderMethod::Basic
+				|| priv::ButtonAccess::isHidden(*button)) {
+				addDirect(component, 2);
+				return;
+			}
+
+			const Hitbox& hitbox = priv::ButtonAccess::getVirtualHitbox(*button);
+			const Color color = priv::ButtonAccess::getCurrentColor(*button);
+
+			if (button->shape == Button::Shape::Rectangle) {
+				const Vec2f position = hitbox.getPosition(), size = hitbox.getSize();
+				const Vec2f points[4] = {
+					position, Vec2f(position.x + size.x, position.y),
+					position + size, Vec2f(position.x, position.y + size.y)
+				};
+
+				addGeometry(
+					points, 4, sf::Transform::Identity, color,
+					button->getOutlineThickness(), button->getOutlineColor()
+				);
+			}
+			else {
+				// Same point count as the default sf::CircleShape.
+				const size_t count = 30;
+				const Vec2f center = hitbox.getCenter();
+				const float radius = hitbox.getRadius();
+				Vec2f points[count];
+
+				for (size_t i = 0; i < count; i++) {
+					const float angle = static_cast<float>(i) * util::TAU
+						/ static_cast<float>(count) - util::PI / 2.0f;
+					points[i] = Vec2f(center.x + std::cos(angle) * radius,
+						center.y + std::sin(angle) * radius);
+				}
+				addGeometry(
+					points, count, sf::Transform::Identity, color,
+					button->getOutlineThickness(), button->getOutlineColor()
+				);
+			}
+
+			if (!button->getString().empty())
+				addDirect(priv::ButtonAccess::getText(*button),
+					button->textHasShadow() ? 2 : 1);
+		}
+		else if (Sprite* sprite = dynamic_cast<Sprite*>(&component)) {
+			GLASS_PROFILE_ZONE("BatchRenderer::add Sprite");
+			addSprite(sprite->getSprite());
+
+			if (sprite->getOutlineThickness() != 0.0f) {
+				const sf::FloatRect bounds = sprite->getSprite().getGlobalBounds();
+				const Vec2f points[4] = {
+					Vec2f(bounds.left, bounds.top),
+					Vec2f(bounds.left + bounds.width, bounds.top),
+					Vec2f(bounds.left + bounds.width, bounds.top + bounds.height),
+					Vec2f(bounds.left, bounds.top + bounds.height)
+				};
+
+				addGeometry(
+					points, 4, sf::Transform::Identity, Color::Transparent,
+					sprite->getOutlineThickness(), sprite->getOutlineColor()
+				);
+			}
+		}
+		else if (Text* text = dynamic_cast<Text*>(&component))
+			addDirect(component, text->hasShadow() ? 2 : 1);
+		else
+			addDirect(component, 1);
+	}
+	inline void BatchRenderer::end() {
+		GLASS_PROFILE_ZONE("BatchRenderer::end");
+
+		if (target == nullptr)
+			return;
+
+		sf::RenderStates batchStates = renderStates;
+		batchStates.transform = sf::Transform::Identity;
+		drawCalls = 0;
+
+		for (const Batch& batch : batches) {
+			if (batch.component != nullptr) {
+				GLASS_PROFILE_COMPONENT(*batch.component);
+				batch.component->render(target, renderStates);
+			}
+			else {
+				const sf::VertexArray& vertices = vertexPool[batch.vertexIndex];
+
+				if (vertices.getVertexCount() == 0)
+					continue;
+
+				batchStates.texture = batch.texture;
+				target->draw(vertices, batchStates);
+			}
+			drawCalls++;
+		}
+
+		drawCallsSaved = unbatchedDrawCalls > drawCalls
+			? unbatchedDrawCalls - drawCalls : 0;
+		target = nullptr;
+	}
+	inline void BatchRenderer::render(
+		sf::RenderTarget* target, Menu& menu, sf::RenderStates renderStates
+	) {
+		begin(target, renderStates);
+		add(menu);
+		end();
+	}
+
+	inline size_t BatchRenderer::getDrawCalls() const {
+		return drawCalls;
+	}
+	inline size_t BatchRenderer::getDrawCallsSaved() const {
+		return drawCallsSaved;
+	}
+
+	inline sf::VertexArray& BatchRenderer::getBatch(
+		const sf::Texture* texture, const sf::FloatRect& bounds
+	) {
+		// Only look back a limited amount to keep adding O(1).
+		const size_t maxLookBack = 32;
+		size_t looked = 0;
+
+		for (size_t i = batches.size(); i > 0 && looked < maxLookBack;
+			i--, looked++) {
+			Batch& batch = batches[i - 1];
+
+			if (batch.component == nullptr && batch.texture == texture) {
+				if (batch.bounds.width == 0.0f && batch.bounds.height == 0.0f)
+					batch.bounds = bounds;
+				else {
+					const float right = std::max(batch.bounds.left
+						+ batch.bounds.width, bounds.left + bounds.width);
+					const float bottom = std::max(batch.bounds.top
+						+ batch.bounds.height, bounds.top + bounds.height);
+					batch.bounds.left = std::min(batch.bounds.left, bounds.left);
+					batch.bounds.top = std::min(batch.bounds.top, bounds.top);
+					batch.bounds.width = right - batch.bounds.left;
+					batch.bounds.height = bottom - batch.bounds.top;
+				}
+				return vertexPool[batch.vertexIndex];
+			}
+			if (batch.bounds.intersects(bounds))
+				break;
+		}
+
+		Batch batch;
+		batch.texture = texture;
+		batch.vertexIndex = vertexPoolUsed++;
+		batch.bounds = bounds;
+		batches.push_back(batch);
+
+		if (vertexPool.size() < vertexPoolUsed)
+			vertexPool.emplace_back(sf::Triangles);
+		vertexPool[batch.vertexIndex].clear();
+
+		return vertexPool[batch.vertexIndex];
+	}
+	inline void BatchRenderer::addDirect(Component& component, size_t drawCalls) {
+		Batch batch;
+		batch.component = &component;
+		batch.bounds = boundsOf(component.getHitbox(), 0.0f);
+
+		if (Text* text = dynamic_cast<Text*>(&component)) {
+			const Vec2f offset = text->hasShadow()
+				? text->getShadowOffset() : Vec2f();
+			batch.bounds = boundsOf(component.getHitbox(),
+				std::max(std::abs(offset.x), std::abs(offset.y))
+				+ text->getOutlineThickness());
+		}
+		batch.bounds = renderStates.transform.transformRect(batch.bounds);
+
+		if (dynamic_cast<Text*>(&component) == nullptr
+			&& dynamic_cast<RoundedRectangle*>(&component) == nullptr
+			&& dynamic_cast<Sprite*>(&component) == nullptr) {
+			// Unknown Components might draw outside their Hitbox.
+			const float huge = 1e30f;
+			batch.bounds = sf::FloatRect(-huge, -huge, 2.0f * huge, 2.0f * huge);
+		}
+		batches.push_back(batch);
+		unbatchedDrawCalls += drawCalls;
+	}
+	inline void BatchRenderer::addGeometry(
+		const Vec2f* points, size_t count, const sf::Transform& transform,
+		Color fillColor, float outlineThickness, Color outlineColor
+	) {
+		const sf::Transform combined = renderStates.transform * transform;
+		Vec2f minimum(std::numeric_limits<float>::max(),
+			std::numeric_limits<float>::max());
+		Vec2f maximum(-minimum.x, -minimum.y);
+
+		for (size_t i = 0; i < count; i++) {
+			const Vec2f point = combined.transformPoint(points[i]);
+			minimum = Vec2f(std::min(minimum.x, point.x), std::min(minimum.y, point.y));
+			maximum = Vec2f(std::max(maximum.x, point.x), std::max(maximum.y, point.y));
+		}
+
+		const float margin = std::abs(outlineThickness) * 2.0f;
+		const sf::FloatRect bounds(
+			minimum.x - margin, minimum.y - margin,
+			maximum.x - minimum.x + margin * 2.0f,
+			maximum.y - minimum.y + margin * 2.0f
+		);
+
+		unbatchedDrawCalls += priv::appendShape(
+			getBatch(nullptr, bounds), points, count, combined,
+			fillColor, outlineThickness, outlineColor
+		);
+	}
+	inline void BatchRenderer::addSprite(const sf::Sprite& sprite) {
+		const sf::Texture* texture = sprite.getTexture();
+
+		if (texture == nullptr)
+			return;
+
+		const sf::Transform combined = renderStates.transform
+			* sprite.getTransform();
+		const sf::IntRect rect = sprite.getTextureRect();
+		const float width = static_cast<float>(std::abs(rect.width));
+		const float height = static_cast<float>(std::abs(rect.height));
+		const float left = static_cast<float>(rect.left);
+		const float right = left + rect.width;
+		const float top = static_cast<float>(rect.top);
+		const float bottom = top + rect.height;
+		const Color color = sprite.getColor();
+
+		const sf::Vertex quad[4] = {
+			sf::Vertex(combined.transformPoint(0.0f, 0.0f), color, Vec2f(left, top)),
+			sf::Vertex(combined.transformPoint(width, 0.0f), color, Vec2f(right, top)),
+			sf::Vertex(combined.transformPoint(width, height), color, Vec2f(right, bottom)),
+			sf::Vertex(combined.transformPoint(0.0f, height), color, Vec2f(left, bottom))
+		};
+		sf::VertexArray& vertices = getBatch(texture,
+			combined.transformRect(sf::FloatRect(0.0f, 0.0f, width, height)));
+
+		vertices.append(quad[0]);
+		vertices.append(quad[1]);
+		vertices.append(quad[2]);
+		vertices.append(quad[0]);
+		vertices.append(quad[2]);
+		vertices.append(quad[3]);
+		unbatchedDrawCalls++;
+	}
+
+	inline sf::FloatRect BatchRenderer::boundsOf(const Hitbox& hitbox, float margin) {
+		if (hitbox.shape == Hitbox::Shape::Circle) {
+			const Vec2f center = hitbox.getCenter();
+			const float radius = hitbox.getRadius() + margin;
+			return sf::FloatRect(center.x - radius, center.y - radius,
+				radius * 2.0f, radius * 2.0f);
+		}
+
+		const Vec2f position = hitbox.getPosition(), size = hitbox.getSize();
+		return sf::FloatRect(position.x - margin, position.y - margin,
+			size.x + margin * 2.0f, size.y + margin * 2.0f);
+	}
+
+	///////////////////////////////////////////////////////////
+	/// BatchedMenu
+	///////////////////////////////////////////////////////////
+
+	inline void BatchedMenu::update() {
+		if (isLocked())
+			return;
+
+		GLASS_PROFILE_ZONE("Menu::update");
+
+		// Like Menu::update() with a zone per Component, skipping
+		// empty containers like BatchRenderer::add().
+		updateInternalComponents();
+
+		for (ComponentContainer& container : components) {
+			if (container.ptr == nullptr)
+				continue;
+
+			GLASS_PROFILE_COMPONENT(*container.ptr);
+			container.ptr->update();
+		}
+	}
+	inline void BatchedMenu::render(
+		sf::RenderTarget* target, sf::RenderStates renderStates
+	) {
+		GLASS_PROFILE_ZONE("Menu::render");
+
+		if (batching) {
+			batchRenderer.render(target, *this, renderStates);
+			return;
+		}
+
+		// Like Menu::render() with a zone per Component.
+		for (ComponentContainer& container : components) {
+			if (container.ptr == nullptr)
+				continue;
+
+			GLASS_PROFILE_COMPONENT(*container.ptr);
+			container.ptr->render(target, renderStates);
+		}
+	}
+
+	inline void BatchedMenu::setBatching(bool enabled) {
+		batching = enabled;
+	}
+
+	inline bool BatchedMenu::getBatching() const {
+		return batching;
+	}
+	inline size_t BatchedMenu::getDrawCallsSaved() const {
+		return batching ? batchRenderer.getDrawCallsSaved() : 0;
+	}
+}
\ No newline at end of file
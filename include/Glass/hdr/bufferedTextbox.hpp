@@ -0,0 +1,186 @@
+#pragma once
+
+// Dependencies
+#include <algorithm>
+#include <cctype>
+
+#include "textbox.hpp"
+#include "input/eventQueue.hpp"
+#include "util/profiler.hpp"
+
+namespace gs {
+	///////////////////////////////////////////////////////////
+	/// class BufferedTextbox is a Textbox that reads every text
+	/// event of the frame from input::getEventQueue() instead of
+	/// the single input::textUnicode, so fast typing and low
+	/// frame rates don't lose characters. Use
+	/// input::beginFrame() and input::pushEvent() in place of
+	/// updateInputs() and updateEvents(), or an InputContext.
+	///////////////////////////////////////////////////////////
+	class BufferedTextbox : public Textbox {
+	public:
+		BufferedTextbox() = default;
+		~BufferedTextbox() = default;
+
+		///////////////////////////////////////////////////////////
+		/// Method update() will update the Textbox and then apply
+		/// all of the text events of this frame in order. Enter
+		/// stores the typed string and ends typing like Textbox.
+		///////////////////////////////////////////////////////////
+		virtual void update() override;
+
+		///////////////////////////////////////////////////////////
+		/// Method insert() will append a string as if it was typed,
+		/// such as a paste from the clipboard. Invalid characters
+		/// are skipped and the maximum input length is kept. If
+		/// the Textbox isn't active the stored string is appended
+		/// to instead. The Text is only updated once.
+		/// @param const std::string& string: String to append.
+		/// @returns size_t: Number of characters appended.
+		///////////////////////////////////////////////////////////
+		virtual size_t insert(const std::string& string);
+
+		///////////////////////////////////////////////////////////
+		/// @param std::uint32_t unicode: Character to check.
+		/// @returns bool: True if validInputs accepts the character
+		///  the same way Textbox does.
+		///////////////////////////////////////////////////////////
+		virtual bool isValid(std::uint32_t unicode) const;
+	protected:
+		///////////////////////////////////////////////////////////
+		/// Method type() will apply one typed character to the
+		/// string being typed without updating the Text.
+		/// @param std::uint32_t unicode: Typed character.
+		/// @returns bool: True if the string being typed changed.
+		///////////////////////////////////////////////////////////
+		virtual bool type(std::uint32_t unicode);
+		///////////////////////////////////////////////////////////
+		/// Method updateText() will show the string being typed
+		/// with the cursor while active, or the string chosen by
+		/// textRenderMethod otherwise, like Textbox::update().
+		///////////////////////////////////////////////////////////
+		virtual void updateText();
+	};
+
+	///////////////////////////////////////////////////////////
+	/// BufferedTextbox
+	///////////////////////////////////////////////////////////
+
+	inline void BufferedTextbox::update() {
+		GLASS_PROFILE_ZONE("BufferedTextbox::update");
+
+		// Hide the last character and Enter from Textbox::update()
+		// so they are applied in order with the queue. -1 is no
+		// input.
+		const int textUnicode = input::textUnicode;
+		const bool space = input::priv::space, backSpace = input::priv::backSpace,
+			enter = input::priv::enter;
+		input::textUnicode = -1;
+		input::priv::space = false;
+		input::priv::backSpace = false;
+		input::priv::enter = false;
+
+		Textbox::update();
+
+		input::textUnicode = textUnicode;
+		input::priv::space = space;
+		input::priv::backSpace = backSpace;
+		input::priv::enter = enter;
+
+		if (!isActive || inputMethod != InputMethod::Keyboard)
+			return;
+
+		bool changed = false, entered = false;
+		for (const input::InputEvent& event : input::getEventQueue()) {
+			if (event.type == input::InputEvent::Type::KeyPressed
+				&& event.code == static_cast<std::uint32_t>(sf::Keyboard::Enter)) {
+				entered = true;
+				break;
+			}
+			if (event.type == input::InputEvent::Type::Text)
+				changed |= type(event.code);
+		}
+
+		// Enter without the event queue, such as from updateEvents().
+		if (entered || enter) {
+			storedString.assign(parsingString);
+			isActive = false;
+			changed = true;
+		}
+
+		if (changed)
+			updateText();
+	}
+
+	inline size_t BufferedTextbox::insert(const std::string& string) {
+		std::string& target = isActive ? parsingString : storedString;
+		const size_t length = target.size();
+
+		for (char character : string) {
+			if (target.size() >= maxLength)
+				break;
+			if (isValid(static_cast<unsigned char>(character)))
+				target.push_back(character);
+		}
+
+		if (target.size() != length)
+			updateText();
+		return target.size() - length;
+	}
+
+	inline bool BufferedTextbox::isValid(std::uint32_t unicode) const {
+		// The <cctype> functions are only defined for unsigned char.
+		if (unicode > 127)
+			return false;
+
+		const int character = static_cast<int>(unicode);
+
+		switch (validInputs) {
+		case ValidInputs::Alpha:
+			return std::isalpha(character) != 0 || character == ' ';
+		case ValidInputs::Numeric:
+			return std::isdigit(character) != 0;
+		default:
+			return std::isalnum(character) != 0 || character == ' ';
+		}
+	}
+
+	inline bool BufferedTextbox::type(std::uint32_t unicode) {
+		// Backspace.
+		if (unicode == 8) {
+			if (parsingString.empty())
+				return false;
+			parsingString.pop_back();
+			return true;
+		}
+
+		if (parsingString.size() >= maxLength || !isValid(unicode))
+			return false;
+
+		parsingString.push_back(static_cast<char>(unicode));
+		return true;
+	}
+	inline void BufferedTextbox::updateText() {
+		if (isActive) {
+			const int tickSpeed = std::max(cursorTickSpeed, 1);
+			const bool cursor = input::priv::ticks % tickSpeed < std::max(tickSpeed / 2, 1);
+			setString(parsingString + (cursor ? "|" : " "));
+			return;
+		}
+
+		switch (textRenderMethod) {
+		case TextRenderMethod::None:
+			setString("");
+			break;
+		case TextRenderMethod::Message:
+			setString(defaultMessage);
+			break;
+		case TextRenderMethod::StoredValue:
+			setString(storedString);
+			break;
+		case TextRenderMethod::MessageAndStoredValue:
+			setString(storedString.empty() ? defaultMessage : storedString);
+			break;
+		}
+	}
+}
\ No newline at end of file
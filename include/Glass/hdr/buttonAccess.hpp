@@ -0,0 +1,32 @@
+#pragma once
+
+// Dependencies
+#include "button.hpp"
+
+namespace gs {
+	namespace priv {
+		///////////////////////////////////////////////////////////
+		/// struct ButtonAccess is used to read the protected render
+		/// state of a Button so it can be drawn by other
+		/// renderers. It is never constructed.
+		///////////////////////////////////////////////////////////
+		struct ButtonAccess : public Button {
+			static const Hitbox& getVirtualHitbox(const Button& button) {
+				return button.*(&ButtonAccess::virtualHitbox);
+			}
+			static Color getCurrentColor(const Button& button) {
+				return button.*(&ButtonAccess::currentColor);
+			}
+			static Text& getText(Button& button) {
+				return button.*(&ButtonAccess::text);
+			}
+			static bool isHidden(const Button& button) {
+				return (button.isSelected && (static_cast<int>(
+					button.eventSelected) & static_cast<int>(
+					EventSelected::Hide))) || (button.isClickedOn
+					&& (static_cast<int>(button.eventClicked) & static_cast<int>(
+					EventClicked::Hide)));
+			}
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,264 @@
+#pragma once
+
+// Dependencies
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "roundedRectangle.hpp"
+
+namespace gs {
+	namespace priv {
+		/// Largest cornerPointCount looked up without a lock.
+		static const unsigned int cornerArcSlotCount = 256;
+
+		///////////////////////////////////////////////////////////
+		/// Function computeCornerArcs() will compute the unit corner
+		/// arcs used by getCornerArcs().
+		/// @param unsigned int cornerPointCount: Vertex count of
+		///  each corner.
+		/// @returns vector<Vec2f>*: New 4 * cornerPointCount unit
+		///  offsets.
+		///////////////////////////////////////////////////////////
+		inline vector<Vec2f>* computeCornerArcs(unsigned int cornerPointCount) {
+			vector<Vec2f>* arcs = new vector<Vec2f>(cornerPointCount * 4);
+
+			// Same angles as RoundedRectangleShape::getPoint().
+			const double deltaAngle = cornerPointCount > 1
+				? 90.0 / (cornerPointCount - 1) : 90.0;
+			const double toRadians = 3.14159265358979323846 / 180.0;
+
+			for (unsigned int i = 0; i < cornerPointCount * 4; i++) {
+				const unsigned int corner = i / cornerPointCount;
+				const double angle = (cornerPointCount > 1
+					? deltaAngle * (i - corner) : 90.0 * corner) * toRadians;
+				(*arcs)[i] = Vec2f(static_cast<float>(std::cos(angle)),
+					static_cast<float>(-std::sin(angle)));
+			}
+			return arcs;
+		}
+
+		///////////////////////////////////////////////////////////
+		/// Function getCornerArcs() will return the unit corner
+		/// arcs of a rounded rectangle with a given number of
+		/// points per corner. The arcs are computed once per point
+		/// count and shared by the whole process. Point i of a
+		/// shape is center of corner (i / cornerPointCount) plus
+		/// radius times arc i. Counts up to cornerArcSlotCount are
+		/// found with a single atomic load once computed, larger
+		/// counts take a lock.
+		/// @param unsigned int cornerPointCount: Vertex count of
+		///  each corner.
+		/// @returns const vector<Vec2f>&: 4 * cornerPointCount unit
+		///  offsets. The reference stays valid for the lifetime of
+		///  the program.
+		///////////////////////////////////////////////////////////
+		inline const vector<Vec2f>& getCornerArcs(unsigned int cornerPointCount) {
+			static std::atomic<const vector<Vec2f>*> slots[cornerArcSlotCount + 1];
+			static std::mutex mutex;
+			static std::unordered_map<unsigned int,
+				std::unique_ptr<vector<Vec2f>>> cache;
+
+			const bool slotted = cornerPointCount <= cornerArcSlotCount;
+
+			if (slotted) {
+				const vector<Vec2f>* arcs = slots[cornerPointCount].load(
+					std::memory_order_acquire);
+				if (arcs != nullptr)
+					return *arcs;
+			}
+
+			std::lock_guard<std::mutex> lock(mutex);
+			std::unique_ptr<vector<Vec2f>>& arcs = cache[cornerPointCount];
+
+			if (arcs == nullptr) {
+				arcs.reset(computeCornerArcs(cornerPointCount));
+				if (slotted)
+					slots[cornerPointCount].store(arcs.get(), std::memory_order_release);
+			}
+			return *arcs;
+		}
+
+		///////////////////////////////////////////////////////////
+		/// Function getCornerCenter() will return the center of one
+		/// of the corner arcs of a rounded rectangle.
+		/// @param unsigned int corner: Corner index from 0 to 3.
+		///  0 is the top right corner going counter clockwise.
+		/// @param Vec2f size: Size of the rectangle.
+		/// @param float radius: Radius of the corners.
+		/// @returns Vec2f: Center of the corner arc.
+		///////////////////////////////////////////////////////////
+		inline Vec2f getCornerCenter(unsigned int corner, Vec2f size, float radius) {
+			switch (corner) {
+			case 0:
+				return Vec2f(size.x - radius, radius);
+			case 1:
+				return Vec2f(radius, radius);
+			case 2:
+				return Vec2f(radius, size.y - radius);
+			default:
+				return Vec2f(size.x - radius, size.y - radius);
+			}
+		}
+
+		///////////////////////////////////////////////////////////
+		/// Function tessellateRoundedRectangle() will write the
+		/// points of a rounded rectangle using the cached corner
+		/// arcs. This gives the same points as
+		/// RoundedRectangleShape::getPoint() without any trig.
+		/// @param Vec2f* points: Output of 4 * cornerPointCount
+		///  points.
+		/// @param Vec2f size: Size of the rectangle.
+		/// @param float radius: Radius of the corners.
+		/// @param unsigned int cornerPointCount: Vertex count of
+		///  each corner.
+		///////////////////////////////////////////////////////////
+		inline void tessellateRoundedRectangle(
+			Vec2f* points, Vec2f size, float radius,
+			unsigned int cornerPointCount
+		) {
+			const vector<Vec2f>& arcs = getCornerArcs(cornerPointCount);
+
+			for (unsigned int corner = 0; corner < 4; corner++) {
+				const Vec2f center = getCornerCenter(corner, size, radius);
+				const unsigned int first = corner * cornerPointCount;
+
+				for (unsigned int i = first; i < first + cornerPointCount; i++)
+					points[i] = center + arcs[i] * radius;
+			}
+		}
+
+		///////////////////////////////////////////////////////////
+		/// class CachedRoundedRectangleShape is a drop in
+		/// replacement for RoundedRectangleShape. Instead of
+		/// computing every corner point with trig whenever SFML
+		/// updates the shape it scales and offsets the shared
+		/// corner arcs from getCornerArcs(). This makes resizing
+		/// every frame, such as during a Button hover animation,
+		/// cheap.
+		///////////////////////////////////////////////////////////
+		class CachedRoundedRectangleShape final : public sf::Shape {
+		public:
+			///////////////////////////////////////////////////////////
+			/// @param Vec2f size: Size of CachedRoundedRectangleShape.
+			/// @param float radius: Radius of corner in pixels.
+			/// @param unsigned int cornerPointCount: Vertex count.
+			///////////////////////////////////////////////////////////
+			CachedRoundedRectangleShape(
+				Vec2f size = Vec2f(0.0f, 0.0f),
+				float radius = 0.0f,
+				unsigned int cornerPointCount = 0
+			);
+
+			///////////////////////////////////////////////////////////
+			/// Method setSize() will change the size of rectangle.
+			/// @param Vec2f size: New size of shape.
+			///////////////////////////////////////////////////////////
+			void setSize(Vec2f size);
+			///////////////////////////////////////////////////////////
+			/// Method setCornersRadius() will set the arc radius of
+			/// the corners of the rectangle in pixels.
+			/// @param float radius: Arc size in pixels.
+			///////////////////////////////////////////////////////////
+			void setCornersRadius(float radius);
+			///////////////////////////////////////////////////////////
+			/// Method setCornerPointCount() will set the number of
+			/// verticies at the corner of each corner.
+			/// @param unsigned int count: Number of vertices.
+			///////////////////////////////////////////////////////////
+			void setCornerPointCount(unsigned int count);
+
+			///////////////////////////////////////////////////////////
+			/// @return size_t: Number of points in shape.
+			///////////////////////////////////////////////////////////
+			size_t getPointCount() const override;
+			///////////////////////////////////////////////////////////
+			/// @param size_t index: Index in point array.
+			/// @returns sf::Vector2f: Gets point along edge of shape.
+			///////////////////////////////////////////////////////////
+			sf::Vector2f getPoint(size_t index) const override;
+
+			///////////////////////////////////////////////////////////
+			/// @returns Vec2f: Size of shape.
+			///////////////////////////////////////////////////////////
+			Vec2f getSize() const;
+			///////////////////////////////////////////////////////////
+			/// @returns float: Radius of corners in pixels.
+			///////////////////////////////////////////////////////////
+			float getCornersRadius() const;
+			///////////////////////////////////////////////////////////
+			/// @returns unsigned int: Number of verticies per corner.
+			///////////////////////////////////////////////////////////
+			unsigned int getCornerPointCount() const;
+		private:
+			/// Internal size.
+			Vec2f rrSize;
+			/// Internal corner radius.
+			float rrRadius;
+			/// Count of verticies on each corner.
+			unsigned int cornerPointCount;
+			/// Shared unit arcs for the current cornerPointCount.
+			const vector<Vec2f>* arcs;
+			/// Corner centers for the current size and radius.
+			Vec2f centers[4];
+
+			///////////////////////////////////////////////////////////
+			/// Method updateCenters() will recompute the corner
+			/// centers and update the underlying sf::Shape.
+			///////////////////////////////////////////////////////////
+			void updateCenters();
+		};
+
+		inline CachedRoundedRectangleShape::CachedRoundedRectangleShape(
+			Vec2f size, float radius, unsigned int cornerPointCount
+		) : rrSize(size), rrRadius(radius), cornerPointCount(cornerPointCount),
+			arcs(&getCornerArcs(cornerPointCount)) {
+			updateCenters();
+		}
+
+		inline void CachedRoundedRectangleShape::setSize(Vec2f size) {
+			rrSize = size;
+			updateCenters();
+		}
+		inline void CachedRoundedRectangleShape::setCornersRadius(float radius) {
+			rrRadius = radius;
+			updateCenters();
+		}
+		inline void CachedRoundedRectangleShape::setCornerPointCount(
+			unsigned int count
+		) {
+			cornerPointCount = count;
+			arcs = &getCornerArcs(count);
+			updateCenters();
+		}
+
+		inline size_t CachedRoundedRectangleShape::getPointCount() const {
+			return cornerPointCount * 4;
+		}
+		inline sf::Vector2f CachedRoundedRectangleShape::getPoint(
+			size_t index
+		) const {
+			if (index >= arcs->size())
+				return sf::Vector2f(0.0f, 0.0f);
+			return centers[index / cornerPointCount] + (*arcs)[index] * rrRadius;
+		}
+
+		inline Vec2f CachedRoundedRectangleShape::getSize() const {
+			return rrSize;
+		}
+		inline float CachedRoundedRectangleShape::getCornersRadius() const {
+			return rrRadius;
+		}
+		inline unsigned int CachedRoundedRectangleShape::getCornerPointCount() const {
+			return cornerPointCount;
+		}
+
+		inline void CachedRoundedRectangleShape::updateCenters() {
+			for (unsigned int corner = 0; corner < 4; corner++)
+				centers[corner] = getCornerCenter(corner, rrSize, rrRadius);
+			update();
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,331 @@
+#pragma once
+
+// Dependencies
+#include "batchRenderer.hpp"
+#include "slider.hpp"
+#include "input/mouse.hpp"
+#include "util/spatialGrid.hpp"
+#include "util/profiler.hpp"
+
+namespace gs {
+	///////////////////////////////////////////////////////////
+	/// class HitTestMenu is a BatchedMenu that keeps the
+	/// Hitboxes of its Components in a util::SpatialGrid and
+	/// resolves the single topmost Component under the mouse.
+	/// The grid is only updated for Components that moved and
+	/// the mouse is only tested again when it moved or the
+	/// layout changed, including the layout of child Menus.
+	/// With exclusive hover enabled every other Component is
+	/// updated as if the mouse were away, so overlapping
+	/// Components no longer react at once. A child
+	/// Menu counts as hovered when one of its Components is
+	/// under the mouse.
+	///////////////////////////////////////////////////////////
+	class HitTestMenu : public BatchedMenu {
+	public:
+		HitTestMenu() = default;
+		~HitTestMenu() = default;
+
+		///////////////////////////////////////////////////////////
+		/// Method update() will update all of the Components that
+		/// have been added to this Menu unless it is locked. Only
+		/// the topmost hovered Component sees the mouse if
+		/// exclusive hover is enabled.
+		///////////////////////////////////////////////////////////
+		virtual void update() override;
+
+		///////////////////////////////////////////////////////////
+		/// Method setExclusiveHover() will enable or disable
+		/// hiding the mouse from Components that aren't topmost.
+		/// Components being dragged always see the mouse. By
+		/// default it is enabled.
+		/// @param bool exclusive: True to enable exclusive hover.
+		///////////////////////////////////////////////////////////
+		virtual void setExclusiveHover(bool exclusive);
+		///////////////////////////////////////////////////////////
+		/// Method setCellSize() will set the size of the cells of
+		/// the grid. About the size of a typical Component is best.
+		/// By default it is 64.
+		/// @param float cellSize: Width and height of a cell.
+		///////////////////////////////////////////////////////////
+		virtual void setCellSize(float cellSize);
+
+		///////////////////////////////////////////////////////////
+		/// @returns bool: True if exclusive hover is enabled.
+		///////////////////////////////////////////////////////////
+		virtual bool getExclusiveHover() const;
+		///////////////////////////////////////////////////////////
+		/// @returns float: Width and height of a cell.
+		///////////////////////////////////////////////////////////
+		virtual float getCellSize() const;
+		///////////////////////////////////////////////////////////
+		/// @returns Component*: Topmost Component under the mouse
+		///  as of the last update() or nullptr if none.
+		///////////////////////////////////////////////////////////
+		virtual Component* getHovered() const;
+		///////////////////////////////////////////////////////////
+		/// Method getComponentAt() will find the topmost Component
+		/// containing a point. Components added later are on top.
+		/// @param Vec2f point: Point to test.
+		/// @returns Component*: Topmost Component or nullptr.
+		///////////////////////////////////////////////////////////
+		virtual Component* getComponentAt(Vec2f point);
+		///////////////////////////////////////////////////////////
+		/// @returns size_t: Number of times update() tested the
+		///  mouse against the grid.
+		///////////////////////////////////////////////////////////
+		virtual size_t getHitTestCount() const;
+	protected:
+		/// Hitbox bounds of the Components by index.
+		util::SpatialGrid grid;
+		/// Components the grid was built for.
+		vector<Component*> indexed;
+		/// Indices of the Components that are Menus. Their Hitbox
+		/// doesn't cover their Components so they aren't in the
+		/// grid.
+		vector<size_t> menus;
+		/// Bounds of the Components inside each child Menu, in the
+		/// order of menus.
+		vector<vector<sf::FloatRect>> menuLayouts;
+		/// Reused list of bounds while checking menuLayouts.
+		vector<sf::FloatRect> menuLayout;
+		/// Reused result of grid queries.
+		vector<size_t> candidates;
+		/// Topmost Component under the mouse.
+		Component* hovered = nullptr;
+		/// Mouse position of the last test.
+		Vec2f testedMouse;
+		/// True if the mouse hasn't been tested yet.
+		bool firstUpdate = true;
+		/// True if the mouse is hidden from other Components.
+		bool exclusiveHover = true;
+		/// Number of times update() tested the mouse.
+		size_t hitTests = 0;
+
+		///////////////////////////////////////////////////////////
+		/// Method syncGrid() will update the grid for Components
+		/// that were added, removed or moved, and check whether a
+		/// Component inside a child Menu moved.
+		/// @returns bool: True if the layout changed.
+		///////////////////////////////////////////////////////////
+		virtual bool syncGrid();
+		///////////////////////////////////////////////////////////
+		/// Method findTopmost() will find the topmost Component
+		/// containing a point without updating the grid first.
+		/// @param Vec2f point: Point to test.
+		/// @returns Component*: Topmost Component or nullptr.
+		///////////////////////////////////////////////////////////
+		virtual Component* findTopmost(Vec2f point);
+		///////////////////////////////////////////////////////////
+		/// @param Menu& menu: Menu to search.
+		/// @param Vec2f point: Point to test.
+		/// @returns bool: True if a Component of the Menu, or of a
+		///  Menu inside it, contains the point.
+		///////////////////////////////////////////////////////////
+		static bool menuContains(Menu& menu, Vec2f point);
+		///////////////////////////////////////////////////////////
+		/// Method collectLayout() will append the bounds of every
+		/// Component of a Menu, and of Menus inside it.
+		/// @param Menu& menu: Menu to collect.
+		/// @param vector<sf::FloatRect>& layout: Where to append.
+		///////////////////////////////////////////////////////////
+		static void collectLayout(Menu& menu, vector<sf::FloatRect>& layout);
+		///////////////////////////////////////////////////////////
+		/// @param Component& component: Component to check.
+		/// @returns bool: True if the Component is being dragged
+		///  and has to keep seeing the mouse.
+		///////////////////////////////////////////////////////////
+		static bool isCaptured(Component& component);
+		///////////////////////////////////////////////////////////
+		/// @param const Hitbox& hitbox: Hitbox to bound.
+		/// @returns sf::FloatRect: Bounds of the Hitbox.
+		///////////////////////////////////////////////////////////
+		static sf::FloatRect boundsOf(const Hitbox& hitbox);
+	};
+
+	///////////////////////////////////////////////////////////
+	/// HitTestMenu
+	///////////////////////////////////////////////////////////
+
+	inline void HitTestMenu::update() {
+		if (isLocked())
+			return;
+
+		GLASS_PROFILE_ZONE("HitTestMenu::update");
+
+		// Same as Menu::update(), the Components are moved by the
+		// offset of the Menu first.
+		updateInternalComponents();
+
+		const bool layoutChanged = syncGrid();
+
+		// Comparing with the last tested position instead of
+		// input::mouseChange also notices when a parent HitTestMenu
+		// hides the mouse.
+		if (firstUpdate || layoutChanged || input::mousePosition != testedMouse) {
+			testedMouse = input::mousePosition;
+			hovered = findTopmost(input::mousePosition);
+			firstUpdate = false;
+			hitTests++;
+		}
+
+		const Vec2f away(-1e9f, -1e9f);
+
+		// Puts the mouse back even if a Component throws, so an
+		// InputContext saves the real position.
+		struct RestoreMouse {
+			Vec2f position;
+			~RestoreMouse() {
+				input::mousePosition = position;
+			}
+		} restore{ input::mousePosition };
+
+		for (ComponentContainer& container : components) {
+			Component* component = container.ptr;
+			if (component == nullptr)
+				continue;
+
+			GLASS_PROFILE_COMPONENT(*component);
+			if (!exclusiveHover || component == hovered || isCaptured(*component))
+				component->update();
+			else {
+				input::mousePosition = away;
+				component->update();
+				input::mousePosition = restore.position;
+			}
+		}
+	}
+
+	inline void HitTestMenu::setExclusiveHover(bool exclusive) {
+		exclusiveHover = exclusive;
+	}
+	inline void HitTestMenu::setCellSize(float cellSize) {
+		grid.setCellSize(cellSize);
+	}
+
+	inline bool HitTestMenu::getExclusiveHover() const {
+		return exclusiveHover;
+	}
+	inline float HitTestMenu::getCellSize() const {
+		return grid.getCellSize();
+	}
+	inline Component* HitTestMenu::getHovered() const {
+		return hovered;
+	}
+	inline Component* HitTestMenu::getComponentAt(Vec2f point) {
+		syncGrid();
+		return findTopmost(point);
+	}
+	inline size_t HitTestMenu::getHitTestCount() const {
+		return hitTests;
+	}
+
+	inline bool HitTestMenu::syncGrid() {
+		bool changed = false;
+
+		if (indexed.size() != components.size()) {
+			grid.clear();
+			indexed.assign(components.size(), nullptr);
+			changed = true;
+		}
+
+		for (size_t i = 0; i < components.size(); i++) {
+			Component* component = components[i].ptr;
+
+			if (component != indexed[i]) {
+				grid.remove(i);
+				indexed[i] = component;
+				changed = true;
+			}
+			if (component != nullptr && dynamic_cast<Menu*>(component) == nullptr)
+				changed |= grid.set(i, boundsOf(component->getHitbox()));
+		}
+
+		if (changed) {
+			menus.clear();
+			for (size_t i = 0; i < indexed.size(); i++)
+				if (dynamic_cast<Menu*>(indexed[i]) != nullptr)
+					menus.push_back(i);
+			menuLayouts.resize(menus.size());
+		}
+
+		// Child Menus aren't in the grid, so compare the bounds of
+		// their Components with the last frame.
+		for (size_t i = 0; i < menus.size(); i++) {
+			menuLayout.clear();
+			collectLayout(static_cast<Menu&>(*indexed[menus[i]]), menuLayout);
+
+			if (menuLayout != menuLayouts[i]) {
+				menuLayouts[i].swap(menuLayout);
+				changed = true;
+			}
+		}
+		return changed;
+	}
+	inline Component* HitTestMenu::findTopmost(Vec2f point) {
+		grid.query(point, candidates);
+
+		// Both lists are in increasing order so walk them together
+		// from the top.
+		size_t candidate = candidates.size(), menu = menus.size();
+
+		while (candidate > 0 || menu > 0) {
+			if (menu > 0 && (candidate == 0 || menus[menu - 1] > candidates[candidate - 1])) {
+				Component* component = components[menus[--menu]].ptr;
+				if (menuContains(static_cast<Menu&>(*component), point))
+					return component;
+				continue;
+			}
+
+			Component* component = components[candidates[--candidate]].ptr;
+			if (component->getHitbox().intersects(point))
+				return component;
+		}
+		return nullptr;
+	}
+	inline bool HitTestMenu::menuContains(Menu& menu, Vec2f point) {
+		for (ComponentContainer& container : menu.components) {
+			Component* component = container.ptr;
+			if (component == nullptr)
+				continue;
+
+			if (Menu* inner = dynamic_cast<Menu*>(component)) {
+				if (menuContains(*inner, point))
+					return true;
+			}
+			else if (component->getHitbox().intersects(point))
+				return true;
+		}
+		return false;
+	}
+	inline void HitTestMenu::collectLayout(Menu& menu, vector<sf::FloatRect>& layout) {
+		for (ComponentContainer& container : menu.components) {
+			Component* component = container.ptr;
+			if (component == nullptr)
+				continue;
+
+			if (Menu* inner = dynamic_cast<Menu*>(component))
+				collectLayout(*inner, layout);
+			else
+				layout.push_back(boundsOf(component->getHitbox()));
+		}
+	}
+	inline bool HitTestMenu::isCaptured(Component& component) {
+		if (Slider* slider = dynamic_cast<Slider*>(&component))
+			return slider->isClickedOn;
+		if (Button* button = dynamic_cast<Button*>(&component))
+			return button->isClickedOn;
+		return false;
+	}
+	inline sf::FloatRect HitTestMenu::boundsOf(const Hitbox& hitbox) {
+		if (hitbox.shape == Hitbox::Shape::Circle) {
+			const Vec2f center = hitbox.getCenter();
+			const float radius = hitbox.getRadius();
+			return sf::FloatRect(center.x - radius, center.y - radius,
+				radius * 2.0f, radius * 2.0f);
+		}
+
+		const Vec2f position = hitbox.getPosition(), size = hitbox.getSize();
+		return sf::FloatRect(position.x, position.y, size.x, size.y);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,409 @@
+#pragma once
+
+// Dependencies
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+
+#include "hitbox.hpp"
+
+#if !defined(GLASS_DISABLE_SIMD) && defined(__AVX__)
+	#include <immintrin.h>
+	/// Defined if HitboxSet tests 8 Hitboxes at once.
+	#define GLASS_HITBOX_SET_AVX
+#elif !defined(GLASS_DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64) \
+	|| (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+	#include <emmintrin.h>
+	/// Defined if HitboxSet tests 4 Hitboxes at once.
+	#define GLASS_HITBOX_SET_SSE
+#endif
+
+namespace gs {
+	namespace priv {
+		///////////////////////////////////////////////////////////
+		/// Function countTrailingZeros() will find the lowest set
+		/// bit of a non zero mask.
+		/// @param std::uint64_t mask: Non zero mask.
+		/// @returns unsigned int: Index of lowest set bit.
+		///////////////////////////////////////////////////////////
+		inline unsigned int countTrailingZeros(std::uint64_t mask) {
+		#if defined(__GNUC__) || defined(__clang__)
+			return static_cast<unsigned int>(__builtin_ctzll(mask));
+		#else
+			unsigned int index = 0;
+			while ((mask & 1) == 0) {
+				mask >>= 1;
+				index++;
+			}
+			return index;
+		#endif
+		}
+	}
+
+	///////////////////////////////////////////////////////////
+	/// class HitboxSet stores many Hitboxes as separate arrays
+	/// of bounds, centers and radii so a point or rectangle can
+	/// be tested against all of them with SIMD, 8 at a time with
+	/// AVX and 4 at a time with SSE. Without either, or with
+	/// GLASS_DISABLE_SIMD defined, a scalar loop is used. Edges
+	/// count as inside. Results are a bitmask with bit i set if
+	/// Hitbox i is hit, or a list of the hit indices.
+	///////////////////////////////////////////////////////////
+	class HitboxSet {
+	public:
+		HitboxSet() = default;
+		~HitboxSet() = default;
+
+		///////////////////////////////////////////////////////////
+		/// Method add() will add a copy of a Hitbox.
+		/// @param const Hitbox& hitbox: Hitbox to add.
+		/// @returns size_t: Index of the Hitbox in the set.
+		///////////////////////////////////////////////////////////
+		size_t add(const Hitbox& hitbox);
+		///////////////////////////////////////////////////////////
+		/// Method addRectangle() will add a rectangle.
+		/// @param const sf::FloatRect& rect: Rectangle to add.
+		/// @returns size_t: Index of the rectangle in the set.
+		///////////////////////////////////////////////////////////
+		size_t addRectangle(const sf::FloatRect& rect);
+		///////////////////////////////////////////////////////////
+		/// Method addCircle() will add a circle.
+		/// @param Vec2f center: Center of circle.
+		/// @param float radius: Radius of circle.
+		/// @returns size_t: Index of the circle in the set.
+		///////////////////////////////////////////////////////////
+		size_t addCircle(Vec2f center, float radius);
+		///////////////////////////////////////////////////////////
+		/// Method set() will replace a Hitbox in the set.
+		/// @param size_t index: Index of Hitbox.
+		/// @param const Hitbox& hitbox: New Hitbox.
+		///////////////////////////////////////////////////////////
+		void set(size_t index, const Hitbox& hitbox);
+		///////////////////////////////////////////////////////////
+		/// Method clear() will remove all of the Hitboxes.
+		///////////////////////////////////////////////////////////
+		void clear();
+		///////////////////////////////////////////////////////////
+		/// Method reserve() will allocate room for Hitboxes.
+		/// @param size_t count: Number of Hitboxes.
+		///////////////////////////////////////////////////////////
+		void reserve(size_t count);
+
+		///////////////////////////////////////////////////////////
+		/// Method intersectsMask() will test a point against every
+		/// Hitbox.
+		/// @param Vec2f point: Point to test.
+		/// @param vector<std::uint64_t>& mask: Set to (size() + 63)
+		///  / 64 words, bit i of word i / 64 is set if Hitbox i
+		///  contains the point.
+		///////////////////////////////////////////////////////////
+		void intersectsMask(Vec2f point, vector<std::uint64_t>& mask) const;
+		///////////////////////////////////////////////////////////
+		/// Method intersectsMask() will test a rectangle against
+		/// every Hitbox.
+		/// @param const sf::FloatRect& rect: Rectangle to test.
+		/// @param vector<std::uint64_t>& mask: Set to (size() + 63)
+		///  / 64 words, bit i of word i / 64 is set if Hitbox i
+		///  overlaps the rectangle.
+		///////////////////////////////////////////////////////////
+		void intersectsMask(const sf::FloatRect& rect, vector<std::uint64_t>& mask) const;
+		///////////////////////////////////////////////////////////
+		/// Method intersects() will find every Hitbox containing a
+		/// point.
+		/// @param Vec2f point: Point to test.
+		/// @param vector<size_t>& indices: Cleared and then filled
+		///  with the indices in increasing order.
+		///////////////////////////////////////////////////////////
+		void intersects(Vec2f point, vector<size_t>& indices) const;
+		///////////////////////////////////////////////////////////
+		/// Method intersects() will find every Hitbox overlapping
+		/// a rectangle.
+		/// @param const sf::FloatRect& rect: Rectangle to test.
+		/// @param vector<size_t>& indices: Cleared and then filled
+		///  with the indices in increasing order.
+		///////////////////////////////////////////////////////////
+		void intersects(const sf::FloatRect& rect, vector<size_t>& indices) const;
+		///////////////////////////////////////////////////////////
+		/// Method setSimd() will enable or disable the SIMD code.
+		/// Disabling it is only useful for benchmarks and tests.
+		/// @param bool enabled: False to use the scalar loop.
+		///////////////////////////////////////////////////////////
+		void setSimd(bool enabled);
+
+		///////////////////////////////////////////////////////////
+		/// @returns size_t: Number of Hitboxes.
+		///////////////////////////////////////////////////////////
+		size_t size() const;
+		///////////////////////////////////////////////////////////
+		/// @returns const char*: "AVX", "SSE" or "Scalar".
+		///////////////////////////////////////////////////////////
+		static const char* getInstructionSet();
+	protected:
+		/// Number of Hitboxes processed per block. The arrays are
+		/// padded to a multiple of it with Hitboxes nothing hits.
+		static const size_t blockSize = 8;
+
+		/// Bounds of every Hitbox.
+		vector<float> left, top, right, bottom;
+		/// Center of every circle, 0 for rectangles.
+		vector<float> centerX, centerY;
+		/// Squared radius of every circle, infinity for rectangles.
+		vector<float> radiusSquared;
+		/// Number of Hitboxes.
+		size_t count = 0;
+		/// False to use the scalar loop.
+		bool simd = true;
+
+		///////////////////////////////////////////////////////////
+		/// Method store() will write a Hitbox to the arrays.
+		/// @param size_t index: Index of Hitbox.
+		/// @param const sf::FloatRect& bounds: Bounds of Hitbox.
+		/// @param Vec2f center: Center if it is a circle.
+		/// @param float radius: Radius or a negative value if it
+		///  is a rectangle.
+		///////////////////////////////////////////////////////////
+		void store(size_t index, const sf::FloatRect& bounds, Vec2f center, float radius);
+		///////////////////////////////////////////////////////////
+		/// Method test() will test a query against every block. A
+		/// point is a rectangle with no size.
+		/// @param float x1, y1, x2, y2: Bounds of the query.
+		/// @param Output&& output: Called with the index of the
+		///  first Hitbox of every block and its 8 bit mask.
+		///////////////////////////////////////////////////////////
+		template <typename Output>
+		void test(float x1, float y1, float x2, float y2, Output&& output) const;
+		///////////////////////////////////////////////////////////
+		/// Method testMask() will compute the mask of a query.
+		/// @param float x1, y1, x2, y2: Bounds of the query.
+		/// @param vector<std::uint64_t>& mask: Result.
+		///////////////////////////////////////////////////////////
+		void testMask(float x1, float y1, float x2, float y2, vector<std::uint64_t>& mask) const;
+		///////////////////////////////////////////////////////////
+		/// Method testIndices() will find the indices hit by a
+		/// query.
+		/// @param float x1, y1, x2, y2: Bounds of the query.
+		/// @param vector<size_t>& indices: Result.
+		///////////////////////////////////////////////////////////
+		void testIndices(float x1, float y1, float x2, float y2, vector<size_t>& indices) const;
+		///////////////////////////////////////////////////////////
+		/// Method testScalar() will compute the mask of one block
+		/// without SIMD.
+		/// @param size_t first: Index of first Hitbox in block.
+		/// @param float x1, y1, x2, y2: Bounds of the query.
+		/// @returns unsigned int: 8 bit mask of the block.
+		///////////////////////////////////////////////////////////
+		unsigned int testScalar(size_t first, float x1, float y1, float x2, float y2) const;
+	};
+
+	///////////////////////////////////////////////////////////
+	/// HitboxSet
+	///////////////////////////////////////////////////////////
+
+	inline size_t HitboxSet::add(const Hitbox& hitbox) {
+		const size_t index = count;
+		reserve(count + 1);
+		count++;
+		set(index, hitbox);
+		return index;
+	}
+	inline size_t HitboxSet::addRectangle(const sf::FloatRect& rect) {
+		const size_t index = count;
+		reserve(count + 1);
+		count++;
+		store(index, rect, Vec2f(), -1.0f);
+		return index;
+	}
+	inline size_t HitboxSet::addCircle(Vec2f center, float radius) {
+		const size_t index = count;
+		reserve(count + 1);
+		count++;
+		store(index, sf::FloatRect(center.x - radius, center.y - radius,
+			radius * 2.0f, radius * 2.0f), center, radius);
+		return index;
+	}
+	inline void HitboxSet::set(size_t index, const Hitbox& hitbox) {
+		if (hitbox.shape == Hitbox::Shape::Circle) {
+			const Vec2f center = hitbox.getCenter();
+			const float radius = hitbox.getRadius();
+			store(index, sf::FloatRect(center.x - radius, center.y - radius,
+				radius * 2.0f, radius * 2.0f), center, radius);
+		}
+		else
+			store(index, sf::FloatRect(hitbox.getPosition(), hitbox.getSize()),
+				Vec2f(), -1.0f);
+	}
+	inline void HitboxSet::clear() {
+		for (vector<float>* array : {
+			&left, &top, &right, &bottom, &centerX, &centerY, &radiusSquared })
+			array->clear();
+		count = 0;
+	}
+	inline void HitboxSet::reserve(size_t count) {
+		const size_t padded = (count + blockSize - 1) / blockSize * blockSize;
+		if (padded <= left.size())
+			return;
+
+		// Padding can never be hit since left > right.
+		const float infinity = std::numeric_limits<float>::infinity();
+		left.resize(padded, infinity);
+		right.resize(padded, -infinity);
+		top.resize(padded, infinity);
+		bottom.resize(padded, -infinity);
+		centerX.resize(padded, 0.0f);
+		centerY.resize(padded, 0.0f);
+		radiusSquared.resize(padded, infinity);
+	}
+
+	inline void HitboxSet::intersectsMask(Vec2f point, vector<std::uint64_t>& mask) const {
+		testMask(point.x, point.y, point.x, point.y, mask);
+	}
+	inline void HitboxSet::intersectsMask(
+		const sf::FloatRect& rect, vector<std::uint64_t>& mask
+	) const {
+		testMask(rect.left, rect.top, rect.left + rect.width, rect.top + rect.height, mask);
+	}
+	inline void HitboxSet::intersects(Vec2f point, vector<size_t>& indices) const {
+		testIndices(point.x, point.y, point.x, point.y, indices);
+	}
+	inline void HitboxSet::intersects(const sf::FloatRect& rect, vector<size_t>& indices) const {
+		testIndices(rect.left, rect.top, rect.left + rect.width, rect.top + rect.height, indices);
+	}
+	inline void HitboxSet::setSimd(bool enabled) {
+		simd = enabled;
+	}
+
+	inline size_t HitboxSet::size() const {
+		return count;
+	}
+	inline const char* HitboxSet::getInstructionSet() {
+	#if defined(GLASS_HITBOX_SET_AVX)
+		return "AVX";
+	#elif defined(GLASS_HITBOX_SET_SSE)
+		return "SSE";
+	#else
+		return "Scalar";
+	#endif
+	}
+
+	inline void HitboxSet::store(
+		size_t index, const sf::FloatRect& bounds, Vec2f center, float radius
+	) {
+		left[index] = bounds.left;
+		top[index] = bounds.top;
+		right[index] = bounds.left + bounds.width;
+		bottom[index] = bounds.top + bounds.height;
+
+		// A rectangle passes the circle test for any point.
+		centerX[index] = radius < 0.0f ? 0.0f : center.x;
+		centerY[index] = radius < 0.0f ? 0.0f : center.y;
+		radiusSquared[index] = radius < 0.0f
+			? std::numeric_limits<float>::infinity() : radius * radius;
+	}
+	template <typename Output>
+	inline void HitboxSet::test(
+		float x1, float y1, float x2, float y2, Output&& output
+	) const {
+		// The nearest point of the query to a circle center is the
+		// center clamped to the query, which is the point itself
+		// for point queries.
+		for (size_t first = 0; first < count; first += blockSize) {
+			unsigned int bits = 0;
+
+			if (!simd)
+				bits = testScalar(first, x1, y1, x2, y2);
+			else {
+			#if defined(GLASS_HITBOX_SET_AVX)
+				const __m256 qx1 = _mm256_set1_ps(x1), qy1 = _mm256_set1_ps(y1);
+				const __m256 qx2 = _mm256_set1_ps(x2), qy2 = _mm256_set1_ps(y2);
+				const __m256 cx = _mm256_loadu_ps(&centerX[first]);
+				const __m256 cy = _mm256_loadu_ps(&centerY[first]);
+
+				__m256 hit = _mm256_and_ps(
+					_mm256_and_ps(
+						_mm256_cmp_ps(_mm256_loadu_ps(&left[first]), qx2, _CMP_LE_OQ),
+						_mm256_cmp_ps(_mm256_loadu_ps(&right[first]), qx1, _CMP_GE_OQ)),
+					_mm256_and_ps(
+						_mm256_cmp_ps(_mm256_loadu_ps(&top[first]), qy2, _CMP_LE_OQ),
+						_mm256_cmp_ps(_mm256_loadu_ps(&bottom[first]), qy1, _CMP_GE_OQ)));
+
+				const __m256 dx = _mm256_sub_ps(_mm256_max_ps(qx1, _mm256_min_ps(cx, qx2)), cx);
+				const __m256 dy = _mm256_sub_ps(_mm256_max_ps(qy1, _mm256_min_ps(cy, qy2)), cy);
+				const __m256 distance = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+				hit = _mm256_and_ps(hit, _mm256_cmp_ps(distance,
+					_mm256_loadu_ps(&radiusSquared[first]), _CMP_LE_OQ));
+
+				bits = static_cast<unsigned int>(_mm256_movemask_ps(hit));
+			#elif defined(GLASS_HITBOX_SET_SSE)
+				const __m128 qx1 = _mm_set1_ps(x1), qy1 = _mm_set1_ps(y1);
+				const __m128 qx2 = _mm_set1_ps(x2), qy2 = _mm_set1_ps(y2);
+
+				for (size_t half = 0; half < blockSize; half += 4) {
+					const size_t i = first + half;
+					const __m128 cx = _mm_loadu_ps(&centerX[i]);
+					const __m128 cy = _mm_loadu_ps(&centerY[i]);
+
+					__m128 hit = _mm_and_ps(
+						_mm_and_ps(
+							_mm_cmple_ps(_mm_loadu_ps(&left[i]), qx2),
+							_mm_cmpge_ps(_mm_loadu_ps(&right[i]), qx1)),
+						_mm_and_ps(
+							_mm_cmple_ps(_mm_loadu_ps(&top[i]), qy2),
+							_mm_cmpge_ps(_mm_loadu_ps(&bottom[i]), qy1)));
+
+					const __m128 dx = _mm_sub_ps(_mm_max_ps(qx1, _mm_min_ps(cx, qx2)), cx);
+					const __m128 dy = _mm_sub_ps(_mm_max_ps(qy1, _mm_min_ps(cy, qy2)), cy);
+					const __m128 distance = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+					hit = _mm_and_ps(hit, _mm_cmple_ps(distance, _mm_loadu_ps(&radiusSquared[i])));
+
+					bits |= static_cast<unsigned int>(_mm_movemask_ps(hit)) << half;
+				}
+			#else
+				bits = testScalar(first, x1, y1, x2, y2);
+			#endif
+			}
+
+			if (bits != 0)
+				output(first, bits);
+		}
+	}
+	inline void HitboxSet::testMask(
+		float x1, float y1, float x2, float y2, vector<std::uint64_t>& mask
+	) const {
+		mask.assign((count + 63) / 64, 0);
+
+		test(x1, y1, x2, y2, [&mask](size_t first, unsigned int bits) {
+			mask[first / 64] |= static_cast<std::uint64_t>(bits) << (first % 64);
+		});
+	}
+	inline void HitboxSet::testIndices(
+		float x1, float y1, float x2, float y2, vector<size_t>& indices
+	) const {
+		indices.clear();
+
+		test(x1, y1, x2, y2, [&indices](size_t first, unsigned int bits) {
+			while (bits != 0) {
+				indices.push_back(first + priv::countTrailingZeros(bits));
+				bits &= bits - 1;
+			}
+		});
+	}
+	inline unsigned int HitboxSet::testScalar(
+		size_t first, float x1, float y1, float x2, float y2
+	) const {
+		unsigned int bits = 0;
+
+		for (size_t lane = 0; lane < blockSize; lane++) {
+			const size_t i = first + lane;
+			if (!(left[i] <= x2 && right[i] >= x1 && top[i] <= y2 && bottom[i] >= y1))
+				continue;
+
+			const float nearestX = centerX[i] < x1 ? x1 : centerX[i] > x2 ? x2 : centerX[i];
+			const float nearestY = centerY[i] < y1 ? y1 : centerY[i] > y2 ? y2 : centerY[i];
+			const float dx = nearestX - centerX[i], dy = nearestY - centerY[i];
+
+			if (dx * dx + dy * dy <= radiusSquared[i])
+				bits |= 1u << lane;
+		}
+		return bits;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,225 @@
+#pragma once
+
+// Dependencies
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+#include "key.hpp"
+
+namespace gs {
+	namespace input {
+		///////////////////////////////////////////////////////////
+		/// struct InputEvent is a text, key or mouse button event
+		/// recorded during a frame.
+		///////////////////////////////////////////////////////////
+		struct InputEvent {
+			/// Kind of event.
+			enum class Type : std::uint8_t {
+				Text, KeyPressed, KeyReleased,
+				MousePressed, MouseReleased
+			} type = Type::Text;
+			/// Unicode for Text, sf::Keyboard::Key for keys and
+			/// sf::Mouse::Button for mouse buttons.
+			std::uint32_t code = 0;
+			/// Mouse position in window pixels for mouse events.
+			Vec2f position;
+			/// Modifier keys held for key events.
+			bool alt = false, control = false, shift = false;
+			/// Nanoseconds on a steady clock when it was recorded.
+			long long time = 0;
+		};
+
+		///////////////////////////////////////////////////////////
+		/// class InputEventQueue records every text, key and mouse
+		/// button event of a frame in order. Components read the
+		/// whole queue in update() so nothing is lost when several
+		/// events arrive in one frame. Storage is a fixed array so
+		/// recording never allocates. Events past the capacity are
+		/// counted as dropped.
+		///////////////////////////////////////////////////////////
+		class InputEventQueue {
+		public:
+			/// Most events stored in a frame.
+			static const size_t capacity = 1024;
+
+			InputEventQueue() = default;
+			~InputEventQueue() = default;
+
+			///////////////////////////////////////////////////////////
+			/// Method push() will record an sf::Event if it is a text,
+			/// key or mouse button event.
+			/// @param const sf::Event& event: Event to record.
+			/// @returns bool: False if the event was dropped.
+			///////////////////////////////////////////////////////////
+			bool push(const sf::Event& event);
+			///////////////////////////////////////////////////////////
+			/// Method push() will record an InputEvent.
+			/// @param const InputEvent& event: Event to record.
+			/// @returns bool: False if the queue is full.
+			///////////////////////////////////////////////////////////
+			bool push(const InputEvent& event);
+			///////////////////////////////////////////////////////////
+			/// Method clear() will remove all of the events. Call it
+			/// once at the start of every frame.
+			///////////////////////////////////////////////////////////
+			void clear();
+
+			///////////////////////////////////////////////////////////
+			/// @returns const InputEvent*: Oldest event.
+			///////////////////////////////////////////////////////////
+			const InputEvent* begin() const;
+			///////////////////////////////////////////////////////////
+			/// @returns const InputEvent*: Past the newest event.
+			///////////////////////////////////////////////////////////
+			const InputEvent* end() const;
+			///////////////////////////////////////////////////////////
+			/// @param size_t index: 0 is the oldest event.
+			/// @returns const InputEvent&: Event at the index.
+			///////////////////////////////////////////////////////////
+			const InputEvent& operator[](size_t index) const;
+			///////////////////////////////////////////////////////////
+			/// @returns size_t: Number of events this frame.
+			///////////////////////////////////////////////////////////
+			size_t size() const;
+			///////////////////////////////////////////////////////////
+			/// @returns bool: True if there are no events.
+			///////////////////////////////////////////////////////////
+			bool empty() const;
+			///////////////////////////////////////////////////////////
+			/// @returns size_t: Number of events dropped this frame
+			///  because the queue was full.
+			///////////////////////////////////////////////////////////
+			size_t getDropped() const;
+
+			///////////////////////////////////////////////////////////
+			/// @returns long long: Nanoseconds from the queue epoch on
+			///  a steady clock.
+			///////////////////////////////////////////////////////////
+			static long long now();
+		protected:
+			/// Events of the frame.
+			std::array<InputEvent, capacity> events;
+			/// Number of events of the frame.
+			size_t count = 0;
+			/// Number of events dropped this frame.
+			size_t dropped = 0;
+		};
+
+		namespace priv {
+			///////////////////////////////////////////////////////////
+			/// @returns InputEventQueue*&: Queue that pushEvent() and
+			///  getEventQueue() use.
+			///////////////////////////////////////////////////////////
+			inline InputEventQueue*& currentEventQueue() {
+				static InputEventQueue queue;
+				static InputEventQueue* current = &queue;
+				return current;
+			}
+		}
+
+		///////////////////////////////////////////////////////////
+		/// Function getEventQueue() will get the events of this
+		/// frame. Inside of an InputContext it is the queue of
+		/// the context.
+		/// @returns InputEventQueue&: Events of this frame.
+		///////////////////////////////////////////////////////////
+		inline InputEventQueue& getEventQueue() {
+			return *priv::currentEventQueue();
+		}
+		///////////////////////////////////////////////////////////
+		/// Function beginFrame() will clear the event queue and call
+		/// updateInputs(). Call it in place of updateInputs().
+		///////////////////////////////////////////////////////////
+		inline void beginFrame() {
+			getEventQueue().clear();
+			updateInputs();
+		}
+		///////////////////////////////////////////////////////////
+		/// Function pushEvent() will call updateEvents() and record
+		/// the event in the queue. Call it in place of
+		/// updateEvents().
+		/// @param sf::Event& event: sf::Event to use.
+		///////////////////////////////////////////////////////////
+		inline void pushEvent(sf::Event& event) {
+			updateEvents(event);
+			getEventQueue().push(event);
+		}
+
+		///////////////////////////////////////////////////////////
+		/// InputEventQueue
+		///////////////////////////////////////////////////////////
+
+		inline bool InputEventQueue::push(const sf::Event& event) {
+			InputEvent input;
+
+			switch (event.type) {
+			case sf::Event::TextEntered:
+				input.type = InputEvent::Type::Text;
+				input.code = event.text.unicode;
+				break;
+			case sf::Event::KeyPressed:
+			case sf::Event::KeyReleased:
+				input.type = event.type == sf::Event::KeyPressed
+					? InputEvent::Type::KeyPressed : InputEvent::Type::KeyReleased;
+				input.code = static_cast<std::uint32_t>(event.key.code);
+				input.alt = event.key.alt;
+				input.control = event.key.control;
+				input.shift = event.key.shift;
+				break;
+			case sf::Event::MouseButtonPressed:
+			case sf::Event::MouseButtonReleased:
+				input.type = event.type == sf::Event::MouseButtonPressed
+					? InputEvent::Type::MousePressed : InputEvent::Type::MouseReleased;
+				input.code = static_cast<std::uint32_t>(event.mouseButton.button);
+				input.position = Vec2f(static_cast<float>(event.mouseButton.x),
+					static_cast<float>(event.mouseButton.y));
+				break;
+			default:
+				return true;
+			}
+
+			input.time = now();
+			return push(input);
+		}
+		inline bool InputEventQueue::push(const InputEvent& event) {
+			if (count == capacity) {
+				dropped++;
+				return false;
+			}
+
+			events[count++] = event;
+			return true;
+		}
+		inline void InputEventQueue::clear() {
+			count = 0;
+			dropped = 0;
+		}
+
+		inline const InputEvent* InputEventQueue::begin() const {
+			return events.data();
+		}
+		inline const InputEvent* InputEventQueue::end() const {
+			return events.data() + count;
+		}
+		inline const InputEvent& InputEventQueue::operator[](size_t index) const {
+			return events[index];
+		}
+		inline size_t InputEventQueue::size() const {
+			return count;
+		}
+		inline bool InputEventQueue::empty() const {
+			return count == 0;
+		}
+		inline size_t InputEventQueue::getDropped() const {
+			return dropped;
+		}
+
+		inline long long InputEventQueue::now() {
+			static const std::chrono::steady_clock::time_point epoch
+				= std::chrono::steady_clock::now();
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now() - epoch).count();
+		}
+	}
+}
\ No newline at end of file
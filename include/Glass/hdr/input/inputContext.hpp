@@ -0,0 +1,232 @@
+#pragma once
+
+// Dependencies
+#include <mutex>
+
+#include "eventQueue.hpp"
+#include "../component.hpp"
+
+namespace gs {
+	namespace input {
+		///////////////////////////////////////////////////////////
+		/// class InputContext owns the input state of one window so
+		/// several windows can have independent UIs. Components
+		/// read the gs::input globals, so a context swaps its state
+		/// into them only while its UI is updated and saves it back
+		/// afterwards. The globals outside of a context are left
+		/// untouched. Example:
+		///
+		/// gs::input::InputContext editorInput(&editor);
+		/// gs::input::InputContext previewInput(&preview);
+		///
+		/// editorInput.update();
+		/// while (editor.pollEvent(event))
+		/// 	editorInput.processEvent(event);
+		/// editorInput.update(editorMenu);
+		///
+		/// Contexts can be used from several threads but they are
+		/// applied one at a time, since the Components still read
+		/// the same globals.
+		///////////////////////////////////////////////////////////
+		class InputContext {
+		public:
+			///////////////////////////////////////////////////////////
+			/// struct State is all of the input state of a window.
+			/// It mirrors the globals in gs::input.
+			///////////////////////////////////////////////////////////
+			struct State {
+				sf::RenderWindow* window = nullptr;
+				Vec2f defaultWindowSize;
+				Vec2f mousePosition;
+				Vec2f prvsMousePosition;
+				Vec2f mouseChange;
+				bool activeMouseClickL = false;
+				bool activeMouseClickM = false;
+				bool activeMouseClickR = false;
+				bool mouseClickL = false;
+				bool mouseClickM = false;
+				bool mouseClickR = false;
+				bool space = false;
+				bool backSpace = false;
+				bool enter = false;
+				int textUnicode = 0;
+				int ticks = 0;
+			};
+
+			///////////////////////////////////////////////////////////
+			/// @param sf::RenderWindow* window: Window of the context
+			///  or nullptr to set it later.
+			///////////////////////////////////////////////////////////
+			explicit InputContext(sf::RenderWindow* window = nullptr);
+			~InputContext() = default;
+
+			///////////////////////////////////////////////////////////
+			/// Method setWindow() will give the context its window.
+			/// This is setWindow() for this context only.
+			/// @param sf::RenderWindow* window: Window pointer.
+			///////////////////////////////////////////////////////////
+			void setWindow(sf::RenderWindow* window);
+			///////////////////////////////////////////////////////////
+			/// Method processEvent() will call updateEvents() for this
+			/// context and record the event in its queue. Call it
+			/// inside the event loop of its window.
+			/// @param sf::Event& event: sf::Event to use.
+			///////////////////////////////////////////////////////////
+			void processEvent(sf::Event& event);
+			///////////////////////////////////////////////////////////
+			/// Method update() will clear the event queue and call
+			/// updateInputs() for this context. Call it every frame
+			/// before the event loop.
+			///////////////////////////////////////////////////////////
+			void update();
+			///////////////////////////////////////////////////////////
+			/// Method update() will update a Component or Menu with
+			/// this context applied.
+			/// @param Component& component: Component to update.
+			///////////////////////////////////////////////////////////
+			void update(Component& component);
+			///////////////////////////////////////////////////////////
+			/// Method apply() will call a function with this context
+			/// applied to the gs::input globals.
+			/// @param Function&& function: Function taking no
+			///  arguments.
+			///////////////////////////////////////////////////////////
+			template <typename Function>
+			void apply(Function&& function);
+
+			///////////////////////////////////////////////////////////
+			/// @returns const State&: Input state of the context.
+			///////////////////////////////////////////////////////////
+			const State& getState() const;
+			///////////////////////////////////////////////////////////
+			/// @returns sf::RenderWindow*: Window of the context.
+			///////////////////////////////////////////////////////////
+			sf::RenderWindow* getWindow() const;
+			///////////////////////////////////////////////////////////
+			/// @returns const InputEventQueue&: Events of this frame.
+			///////////////////////////////////////////////////////////
+			const InputEventQueue& getEventQueue() const;
+
+			///////////////////////////////////////////////////////////
+			/// Method load() will copy a State into the globals.
+			/// @param const State& state: State to copy.
+			///////////////////////////////////////////////////////////
+			static void load(const State& state);
+			///////////////////////////////////////////////////////////
+			/// Method save() will copy the globals into a State.
+			/// @param State& state: Where to copy.
+			///////////////////////////////////////////////////////////
+			static void save(State& state);
+		protected:
+			/// Input state of the context.
+			State state;
+			/// Events of this frame.
+			InputEventQueue events;
+
+			///////////////////////////////////////////////////////////
+			/// @returns std::recursive_mutex&: Lock held while any
+			///  context is applied.
+			///////////////////////////////////////////////////////////
+			static std::recursive_mutex& getMutex();
+		};
+
+		///////////////////////////////////////////////////////////
+		/// InputContext
+		///////////////////////////////////////////////////////////
+
+		inline InputContext::InputContext(sf::RenderWindow* window) {
+			if (window != nullptr)
+				setWindow(window);
+		}
+
+		inline void InputContext::setWindow(sf::RenderWindow* window) {
+			apply([window]() { input::setWindow(window); });
+		}
+		inline void InputContext::processEvent(sf::Event& event) {
+			apply([&event]() { input::pushEvent(event); });
+		}
+		inline void InputContext::update() {
+			apply([]() { input::beginFrame(); });
+		}
+		inline void InputContext::update(Component& component) {
+			apply([&component]() { component.update(); });
+		}
+		template <typename Function>
+		inline void InputContext::apply(Function&& function) {
+			std::lock_guard<std::recursive_mutex> lock(getMutex());
+			InputEventQueue*& queue = priv::currentEventQueue();
+			InputEventQueue* outsideQueue = queue;
+			State outside;
+
+			save(outside);
+			load(state);
+			queue = &events;
+
+			// Restore the globals even if the function throws.
+			struct Restore {
+				State& state;
+				const State& outside;
+				InputEventQueue*& queue;
+				InputEventQueue* outsideQueue;
+				~Restore() {
+					save(state);
+					load(outside);
+					queue = outsideQueue;
+				}
+			} restore{ state, outside, queue, outsideQueue };
+
+			function();
+		}
+
+		inline const InputContext::State& InputContext::getState() const {
+			return state;
+		}
+		inline sf::RenderWindow* InputContext::getWindow() const {
+			return state.window;
+		}
+		inline const InputEventQueue& InputContext::getEventQueue() const {
+			return events;
+		}
+
+		inline std::recursive_mutex& InputContext::getMutex() {
+			static std::recursive_mutex mutex;
+			return mutex;
+		}
+		inline void InputContext::load(const State& state) {
+			priv::internalWindow = state.window;
+			priv::defaultWindowSize = state.defaultWindowSize;
+			mousePosition = state.mousePosition;
+			priv::prvsMousePosition = state.prvsMousePosition;
+			mouseChange = state.mouseChange;
+			activeMouseClickL = state.activeMouseClickL;
+			activeMouseClickM = state.activeMouseClickM;
+			activeMouseClickR = state.activeMouseClickR;
+			mouseClickL = state.mouseClickL;
+			mouseClickM = state.mouseClickM;
+			mouseClickR = state.mouseClickR;
+			priv::space = state.space;
+			priv::backSpace = state.backSpace;
+			priv::enter = state.enter;
+			textUnicode = state.textUnicode;
+			priv::ticks = state.ticks;
+		}
+		inline void InputContext::save(State& state) {
+			state.window = priv::internalWindow;
+			state.defaultWindowSize = priv::defaultWindowSize;
+			state.mousePosition = mousePosition;
+			state.prvsMousePosition = priv::prvsMousePosition;
+			state.mouseChange = mouseChange;
+			state.activeMouseClickL = activeMouseClickL;
+			state.activeMouseClickM = activeMouseClickM;
+			state.activeMouseClickR = activeMouseClickR;
+			state.mouseClickL = mouseClickL;
+			state.mouseClickM = mouseClickM;
+			state.mouseClickR = mouseClickR;
+			state.space = priv::space;
+			state.backSpace = priv::backSpace;
+			state.enter = priv::enter;
+			state.textUnicode = textUnicode;
+			state.ticks = priv::ticks;
+		}
+	}
+}
\ No newline at end of file
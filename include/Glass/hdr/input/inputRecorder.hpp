@@ -0,0 +1,415 @@
+#pragma once
+
+// Dependencies
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#include "inputContext.hpp"
+#include "../util/frameTimeHistogram.hpp"
+
+namespace gs {
+	namespace input {
+		namespace priv {
+			///////////////////////////////////////////////////////////
+			/// Function writeBytes() will append an integer to a byte
+			/// buffer in little endian order.
+			/// @param vector<char>& bytes: Buffer to append to.
+			/// @param std::uint64_t value: Value to append.
+			/// @param size_t count: Number of bytes of the value.
+			///////////////////////////////////////////////////////////
+			inline void writeBytes(vector<char>& bytes, std::uint64_t value, size_t count) {
+				for (size_t i = 0; i < count; i++)
+					bytes.push_back(static_cast<char>((value >> (i * 8)) & 0xff));
+			}
+			///////////////////////////////////////////////////////////
+			/// Function readBytes() will read a little endian integer
+			/// from a byte buffer.
+			/// @param const vector<char>& bytes: Buffer to read from.
+			/// @param size_t& offset: Read position. It is advanced.
+			/// @param size_t count: Number of bytes of the value.
+			/// @returns std::uint64_t: Value read.
+			///////////////////////////////////////////////////////////
+			inline std::uint64_t readBytes(const vector<char>& bytes, size_t& offset, size_t count) {
+				std::uint64_t value = 0;
+				for (size_t i = 0; i < count; i++)
+					value |= static_cast<std::uint64_t>(
+						static_cast<unsigned char>(bytes[offset + i])) << (i * 8);
+				offset += count;
+				return value;
+			}
+			///////////////////////////////////////////////////////////
+			/// @param float value: Float to convert.
+			/// @returns std::uint32_t: Bits of the float.
+			///////////////////////////////////////////////////////////
+			inline std::uint32_t floatBits(float value) {
+				std::uint32_t bits;
+				std::memcpy(&bits, &value, sizeof(bits));
+				return bits;
+			}
+			///////////////////////////////////////////////////////////
+			/// @param std::uint32_t bits: Bits of a float.
+			/// @returns float: Float with the bits.
+			///////////////////////////////////////////////////////////
+			inline float bitsFloat(std::uint32_t bits) {
+				float value;
+				std::memcpy(&value, &bits, sizeof(value));
+				return value;
+			}
+		}
+
+		///////////////////////////////////////////////////////////
+		/// class InputRecorder writes the input of every frame to
+		/// a binary file so it can be replayed with InputReplayer.
+		/// A frame is the state of the gs::input globals and the
+		/// events of input::getEventQueue(). Call recordFrame()
+		/// after the event loop of every frame. Example:
+		///
+		/// gs::input::InputRecorder recorder;
+		/// recorder.open("session.glir");
+		///
+		/// gs::input::beginFrame();
+		/// while (window.pollEvent(event))
+		/// 	gs::input::pushEvent(event);
+		/// recorder.recordFrame();
+		///////////////////////////////////////////////////////////
+		class InputRecorder {
+		public:
+			InputRecorder() = default;
+			~InputRecorder();
+
+			///////////////////////////////////////////////////////////
+			/// Method open() will start a new recording.
+			/// @param const std::string& path: Path of the file.
+			/// @returns bool: True if the file was opened.
+			///////////////////////////////////////////////////////////
+			bool open(const std::string& path);
+			///////////////////////////////////////////////////////////
+			/// Method close() will finish the recording.
+			///////////////////////////////////////////////////////////
+			void close();
+			///////////////////////////////////////////////////////////
+			/// Method recordFrame() will write the input of this frame.
+			///////////////////////////////////////////////////////////
+			void recordFrame();
+
+			///////////////////////////////////////////////////////////
+			/// @returns bool: True if a recording is open.
+			///////////////////////////////////////////////////////////
+			bool isOpen() const;
+			///////////////////////////////////////////////////////////
+			/// @returns size_t: Frames written to the recording.
+			///////////////////////////////////////////////////////////
+			size_t getFrameCount() const;
+		protected:
+			/// File of the recording.
+			std::ofstream file;
+			/// Reused bytes of a frame.
+			vector<char> bytes;
+			/// Frames written.
+			size_t frames = 0;
+		};
+
+		///////////////////////////////////////////////////////////
+		/// class InputReplayer plays back a recording made by
+		/// InputRecorder. Each call to nextFrame() sets the
+		/// gs::input globals and the event queue to the recorded
+		/// frame without reading the window, so Menus, Textboxes
+		/// and Sliders can be updated headless with the same input
+		/// every run. The window pointer isn't replayed. Use an
+		/// InputContext to keep the live input untouched.
+		///////////////////////////////////////////////////////////
+		class InputReplayer {
+		public:
+			InputReplayer() = default;
+			~InputReplayer() = default;
+
+			///////////////////////////////////////////////////////////
+			/// Method open() will load a whole recording into memory.
+			/// @param const std::string& path: Path of the file.
+			/// @returns bool: True if the recording was loaded.
+			///////////////////////////////////////////////////////////
+			bool open(const std::string& path);
+			///////////////////////////////////////////////////////////
+			/// Method nextFrame() will apply the next recorded frame.
+			/// @returns bool: False if there are no frames left.
+			///////////////////////////////////////////////////////////
+			bool nextFrame();
+			///////////////////////////////////////////////////////////
+			/// Method rewind() will go back to the first frame.
+			///////////////////////////////////////////////////////////
+			void rewind();
+
+			///////////////////////////////////////////////////////////
+			/// @returns size_t: Number of recorded frames.
+			///////////////////////////////////////////////////////////
+			size_t getFrameCount() const;
+			///////////////////////////////////////////////////////////
+			/// @returns size_t: Number of frames applied so far.
+			///////////////////////////////////////////////////////////
+			size_t getFrameIndex() const;
+		protected:
+			/// Input state of every frame.
+			vector<InputContext::State> states;
+			/// Index of the first event of every frame and the end.
+			vector<size_t> eventStarts;
+			/// Events of all of the frames.
+			vector<InputEvent> events;
+			/// Next frame to apply.
+			size_t frame = 0;
+		};
+
+		///////////////////////////////////////////////////////////
+		/// struct ReplayBenchmark holds the result of
+		/// benchmarkReplay(). Times are of the update function only.
+		///////////////////////////////////////////////////////////
+		struct ReplayBenchmark {
+			/// Statistics of the frame times in milliseconds.
+			util::FrameTimeHistogram::Summary summary;
+			/// Milliseconds of all of the frames.
+			double totalMilliseconds = 0.0;
+			/// Frames that were updated.
+			size_t frames = 0;
+		};
+
+		///////////////////////////////////////////////////////////
+		/// Function benchmarkReplay() will replay a recording and
+		/// time a function that updates the UI every frame.
+		/// Example:
+		///
+		/// gs::input::ReplayBenchmark result = gs::input::benchmarkReplay(
+		/// 	replayer, [&menu]() { menu.update(); }, 10);
+		///
+		/// @param InputReplayer& replayer: Recording to replay. It
+		///  is rewound first.
+		/// @param Function&& update: Function taking no arguments.
+		/// @param size_t repeats: Number of times to replay it.
+		/// @returns ReplayBenchmark: Frame times.
+		///////////////////////////////////////////////////////////
+		template <typename Function>
+		inline ReplayBenchmark benchmarkReplay(
+			InputReplayer& replayer,
+			Function&& update,
+			size_t repeats = 1
+		);
+
+		///////////////////////////////////////////////////////////
+		/// InputRecorder
+		///////////////////////////////////////////////////////////
+
+		namespace priv {
+			/// First bytes of a recording.
+			static const char recordingMagic[4] = { 'G', 'L', 'I', 'R' };
+			/// Version of the recording format.
+			static const std::uint32_t recordingVersion = 1;
+		}
+
+		inline InputRecorder::~InputRecorder() {
+			close();
+		}
+
+		inline bool InputRecorder::open(const std::string& path) {
+			close();
+			file.open(path, std::ios::binary | std::ios::trunc);
+			if (!file.is_open())
+				return false;
+
+			bytes.clear();
+			bytes.insert(bytes.end(), priv::recordingMagic, priv::recordingMagic + 4);
+			priv::writeBytes(bytes, priv::recordingVersion, 4);
+			file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+			frames = 0;
+			return file.good();
+		}
+		inline void InputRecorder::close() {
+			if (file.is_open())
+				file.close();
+		}
+		inline void InputRecorder::recordFrame() {
+			if (!file.is_open())
+				return;
+
+			InputContext::State state;
+			InputContext::save(state);
+			const InputEventQueue& queue = getEventQueue();
+
+			const Vec2f vectors[4] = {
+				state.mousePosition, state.prvsMousePosition,
+				state.mouseChange, state.defaultWindowSize
+			};
+			const bool flags[9] = {
+				state.activeMouseClickL, state.activeMouseClickM, state.activeMouseClickR,
+				state.mouseClickL, state.mouseClickM, state.mouseClickR,
+				state.space, state.backSpace, state.enter
+			};
+
+			bytes.clear();
+			for (const Vec2f& value : vectors) {
+				priv::writeBytes(bytes, priv::floatBits(value.x), 4);
+				priv::writeBytes(bytes, priv::floatBits(value.y), 4);
+			}
+
+			std::uint32_t bits = 0;
+			for (size_t i = 0; i < 9; i++)
+				bits |= static_cast<std::uint32_t>(flags[i]) << i;
+			priv::writeBytes(bytes, bits, 2);
+			priv::writeBytes(bytes, static_cast<std::uint32_t>(state.textUnicode), 4);
+			priv::writeBytes(bytes, static_cast<std::uint32_t>(state.ticks), 4);
+
+			priv::writeBytes(bytes, queue.size(), 4);
+			for (const InputEvent& event : queue) {
+				priv::writeBytes(bytes, static_cast<std::uint8_t>(event.type), 1);
+				priv::writeBytes(bytes, event.code, 4);
+				priv::writeBytes(bytes, priv::floatBits(event.position.x), 4);
+				priv::writeBytes(bytes, priv::floatBits(event.position.y), 4);
+				priv::writeBytes(bytes, static_cast<std::uint32_t>(event.alt)
+					| static_cast<std::uint32_t>(event.control) << 1
+					| static_cast<std::uint32_t>(event.shift) << 2, 1);
+				priv::writeBytes(bytes, static_cast<std::uint64_t>(event.time), 8);
+			}
+
+			file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+			frames++;
+		}
+
+		inline bool InputRecorder::isOpen() const {
+			return file.is_open();
+		}
+		inline size_t InputRecorder::getFrameCount() const {
+			return frames;
+		}
+
+		///////////////////////////////////////////////////////////
+		/// InputReplayer
+		///////////////////////////////////////////////////////////
+
+		inline bool InputReplayer::open(const std::string& path) {
+			states.clear();
+			eventStarts.assign(1, 0);
+			events.clear();
+			frame = 0;
+
+			std::ifstream file(path, std::ios::binary);
+			if (!file.is_open())
+				return false;
+
+			const vector<char> bytes((std::istreambuf_iterator<char>(file)),
+				std::istreambuf_iterator<char>());
+			size_t offset = 8;
+
+			if (bytes.size() < offset || std::memcmp(bytes.data(), priv::recordingMagic, 4) != 0)
+				return false;
+			size_t versionOffset = 4;
+			if (priv::readBytes(bytes, versionOffset, 4) != priv::recordingVersion)
+				return false;
+
+			// Vectors, flags, unicode, ticks and event count.
+			const size_t frameSize = 32 + 2 + 4 + 4 + 4;
+			const size_t eventSize = 1 + 4 + 4 + 4 + 1 + 8;
+
+			while (bytes.size() - offset >= frameSize) {
+				InputContext::State state;
+				Vec2f* vectors[4] = {
+					&state.mousePosition, &state.prvsMousePosition,
+					&state.mouseChange, &state.defaultWindowSize
+				};
+				bool* flags[9] = {
+					&state.activeMouseClickL, &state.activeMouseClickM, &state.activeMouseClickR,
+					&state.mouseClickL, &state.mouseClickM, &state.mouseClickR,
+					&state.space, &state.backSpace, &state.enter
+				};
+
+				for (Vec2f* value : vectors) {
+					value->x = priv::bitsFloat(static_cast<std::uint32_t>(priv::readBytes(bytes, offset, 4)));
+					value->y = priv::bitsFloat(static_cast<std::uint32_t>(priv::readBytes(bytes, offset, 4)));
+				}
+
+				const std::uint64_t bits = priv::readBytes(bytes, offset, 2);
+				for (size_t i = 0; i < 9; i++)
+					*flags[i] = ((bits >> i) & 1) != 0;
+				state.textUnicode = static_cast<int>(static_cast<std::uint32_t>(priv::readBytes(bytes, offset, 4)));
+				state.ticks = static_cast<int>(static_cast<std::uint32_t>(priv::readBytes(bytes, offset, 4)));
+
+				const size_t eventCount = static_cast<size_t>(priv::readBytes(bytes, offset, 4));
+				if ((bytes.size() - offset) / eventSize < eventCount)
+					break;
+
+				for (size_t i = 0; i < eventCount; i++) {
+					InputEvent event;
+					event.type = static_cast<InputEvent::Type>(priv::readBytes(bytes, offset, 1));
+					event.code = static_cast<std::uint32_t>(priv::readBytes(bytes, offset, 4));
+					event.position.x = priv::bitsFloat(static_cast<std::uint32_t>(priv::readBytes(bytes, offset, 4)));
+					event.position.y = priv::bitsFloat(static_cast<std::uint32_t>(priv::readBytes(bytes, offset, 4)));
+					const std::uint64_t modifiers = priv::readBytes(bytes, offset, 1);
+					event.alt = (modifiers & 1) != 0;
+					event.control = (modifiers & 2) != 0;
+					event.shift = (modifiers & 4) != 0;
+					event.time = static_cast<long long>(priv::readBytes(bytes, offset, 8));
+					events.push_back(event);
+				}
+
+				states.push_back(state);
+				eventStarts.push_back(events.size());
+			}
+			return true;
+		}
+		inline bool InputReplayer::nextFrame() {
+			if (frame >= states.size())
+				return false;
+
+			InputContext::State state = states[frame];
+			state.window = input::priv::internalWindow;
+			InputContext::load(state);
+
+			InputEventQueue& queue = getEventQueue();
+			queue.clear();
+			for (size_t i = eventStarts[frame]; i < eventStarts[frame + 1]; i++)
+				queue.push(events[i]);
+
+			frame++;
+			return true;
+		}
+		inline void InputReplayer::rewind() {
+			frame = 0;
+		}
+
+		inline size_t InputReplayer::getFrameCount() const {
+			return states.size();
+		}
+		inline size_t InputReplayer::getFrameIndex() const {
+			return frame;
+		}
+
+		///////////////////////////////////////////////////////////
+		/// benchmarkReplay
+		///////////////////////////////////////////////////////////
+
+		template <typename Function>
+		inline ReplayBenchmark benchmarkReplay(InputReplayer& replayer, Function&& update, size_t repeats) {
+			typedef std::chrono::steady_clock BenchClock;
+
+			ReplayBenchmark result;
+			util::FrameTimeHistogram histogram(std::max<size_t>(replayer.getFrameCount() * repeats, 1));
+
+			for (size_t repeat = 0; repeat < repeats; repeat++) {
+				replayer.rewind();
+
+				while (replayer.nextFrame()) {
+					const BenchClock::time_point start = BenchClock::now();
+					update();
+					const double milliseconds = std::chrono::duration<double, std::milli>(
+						BenchClock::now() - start).count();
+
+					histogram.push(static_cast<float>(milliseconds));
+					result.totalMilliseconds += milliseconds;
+					result.frames++;
+				}
+			}
+
+			result.summary = histogram.getSummary();
+			return result;
+		}
+	}
+}
\ No newline at end of file
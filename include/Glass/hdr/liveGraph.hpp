@@ -0,0 +1,1012 @@
+#pragma once
+
+// Dependencies
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <utility>
+
+#include "graph.hpp"
+#include "polyline.hpp"
+#include "util/concurrentQueue.hpp"
+#include "util/minMaxPyramid.hpp"
+#include "util/profiler.hpp"
+#include "util/ringBuffer.hpp"
+#include "util/slidingWindow.hpp"
+
+namespace gs {
+	///////////////////////////////////////////////////////////
+	/// class LiveGraph is a Graph made for live data. Points
+	/// are stored in a fixed capacity RingBuffer so graphing a
+	/// point never shifts the stored points, and the minimum
+	/// and maximum used to auto adjust the bounds are kept up
+	/// to date in amortized O(1) per point. Rendering is
+	/// incremental: the graph is drawn onto a circular texture
+	/// and each new point only clears and draws its own column
+	/// while the view scrolls by offsetting the texture. The
+	/// whole texture is only redrawn when the bounds, size or
+	/// colors change. The lines and points are each drawn as a
+	/// single mesh so a redraw takes 3 draw calls at any point
+	/// count. With more than 2 points per pixel the points can
+	/// be decimated using a MinMaxPyramid so the cost of a
+	/// redraw depends on the width instead of the point count.
+	/// A LiveGraph can show several named series which share
+	/// the x axis, bounds and texture. Each series stores its
+	/// points in its own contiguous RingBuffer. Series 0 always
+	/// exists and is the one graph(float) adds to.
+	/// Other threads can feed a LiveGraph through submit()
+	/// after a producer queue is attached with
+	/// setProducerQueue(). Everything else must be called on
+	/// the thread that calls update().
+	///////////////////////////////////////////////////////////
+	class LiveGraph : public Graph {
+	public:
+		/// How points are reduced when there are more than 2 per
+		/// pixel. MinMax keeps the minimum and maximum of every
+		/// pixel column, LTTB keeps the points with the largest
+		/// triangle area. By default it is set to None.
+		enum class Decimation { None, MinMax, LTTB }
+			decimation = Decimation::None;
+
+		LiveGraph();
+		~LiveGraph() = default;
+
+		///////////////////////////////////////////////////////////
+		/// Method update() is an overriden Component method that
+		/// is used to update the LiveGraph every time a frame
+		/// passes. This is where the new points are drawn. Series
+		/// that got fewer points than the others since the last
+		/// update() repeat their last point so every series stays
+		/// on the same x axis.
+		///////////////////////////////////////////////////////////
+		virtual void update() override;
+		///////////////////////////////////////////////////////////
+		/// Method render() will render the LiveGraph object to a
+		/// sf::RenderTarget.
+		/// @param sf::RenderTarget* target: Pointer to the target
+		///  you want to render. Example: &window.
+		/// @param sf::RenderStates: Used for advanced blending and
+		///  custom shaders. By default it is set to
+		///  sf::RenderStates::Default.
+		///////////////////////////////////////////////////////////
+		virtual void render(
+			sf::RenderTarget* target,
+			sf::RenderStates renderStates = sf::RenderStates::Default
+		) override;
+
+		///////////////////////////////////////////////////////////
+		/// Method graph() will graph the next point of series 0.
+		/// This is O(1) and never allocates.
+		/// @param float value: Height value of next point.
+		///////////////////////////////////////////////////////////
+		virtual void graph(float value) override;
+		///////////////////////////////////////////////////////////
+		/// Method graph() will graph the next point of a series.
+		/// This is O(1) and never allocates.
+		/// @param size_t series: Index of series.
+		/// @param float value: Height value of next point.
+		///////////////////////////////////////////////////////////
+		void graph(size_t series, float value);
+		///////////////////////////////////////////////////////////
+		/// Method clear() will erase all of the points from every
+		/// series of the LiveGraph.
+		///////////////////////////////////////////////////////////
+		virtual void clear() override;
+		///////////////////////////////////////////////////////////
+		/// Method submit() will queue the next point of series 0
+		/// from any thread. It never blocks, the point is graphed
+		/// by the next update(). Note: With a single producer
+		/// queue only one thread may submit points.
+		/// @param float value: Height value of next point.
+		/// @returns bool: False if there is no producer queue or
+		///  it is full, the point is dropped.
+		///////////////////////////////////////////////////////////
+		bool submit(float value);
+		///////////////////////////////////////////////////////////
+		/// Method submit() will queue the next point of a series
+		/// from any thread. It never blocks, the point is graphed
+		/// by the next update(). Note: With a single producer
+		/// queue only one thread may submit points.
+		/// @param size_t series: Index of series.
+		/// @param float value: Height value of next point.
+		/// @returns bool: False if there is no producer queue or
+		///  it is full, the point is dropped.
+		///////////////////////////////////////////////////////////
+		bool submit(size_t series, float value);
+		///////////////////////////////////////////////////////////
+		/// Method setProducerQueue() will create the queue used by
+		/// submit(). Note: Call this before any thread submits
+		/// points. Points still in the old queue are dropped.
+		/// @param size_t capacity: Points the queue can hold
+		///  between updates. Rounded up to a power of two.
+		/// @param bool multipleProducers: True to allow several
+		///  threads to submit points.
+		///////////////////////////////////////////////////////////
+		void setProducerQueue(size_t capacity, bool multipleProducers = false);
+		///////////////////////////////////////////////////////////
+		/// Method redraw() will make the next update() redraw the
+		/// whole LiveGraph instead of only the new points.
+		///////////////////////////////////////////////////////////
+		void redraw();
+
+		///////////////////////////////////////////////////////////
+		/// Method addSeries() will add a series to the LiveGraph.
+		/// It starts with as many points as the other series, all
+		/// of them empty.
+		/// @param const std::string& name: Name of series.
+		/// @param Color color: Color of the series lines and
+		///  points.
+		/// @returns size_t: Index of the new series.
+		///////////////////////////////////////////////////////////
+		size_t addSeries(const std::string& name, Color color);
+		///////////////////////////////////////////////////////////
+		/// Method setSeriesColor() will change the color of a
+		/// series. Series 0 uses the line and point colors.
+		/// @param size_t series: Index of series.
+		/// @param Color color: New color.
+		///////////////////////////////////////////////////////////
+		void setSeriesColor(size_t series, Color color);
+
+		///////////////////////////////////////////////////////////
+		/// Method applyStyle() will change the visual
+		/// representation of the LiveGraph by changing it's style.
+		/// @param const Style& style: Style to apply to graph.
+		///////////////////////////////////////////////////////////
+		virtual void applyStyle(const Style& style) override;
+		///////////////////////////////////////////////////////////
+		/// Method setSize() will set the size of the LiveGraph.
+		/// @param Vec2f size: New size.
+		///////////////////////////////////////////////////////////
+		virtual void setSize(Vec2f size) override;
+		///////////////////////////////////////////////////////////
+		/// Method setSize() will set the size of the LiveGraph.
+		/// @param float width: New width.
+		/// @param float height New height.
+		///////////////////////////////////////////////////////////
+		virtual void setSize(float width, float height) override;
+		///////////////////////////////////////////////////////////
+		/// Method setLowerBound() will set the minimum yvalue that
+		/// can be viewed on the LiveGraph.
+		/// @param float height: Height value.
+		///////////////////////////////////////////////////////////
+		virtual void setLowerBound(float height) override;
+		///////////////////////////////////////////////////////////
+		/// Method setUpperBound() will set the maximum yvalue that
+		/// can be viewed on the LiveGraph.
+		/// @param float height: Height value.
+		///////////////////////////////////////////////////////////
+		virtual void setUpperBound(float height) override;
+		///////////////////////////////////////////////////////////
+		/// Method setPointCount() will set the number of points at
+		/// one time that can be on the graph before it scrolls.
+		/// The newest points are kept.
+		/// @param size_t numOfPoints: Point count.
+		///////////////////////////////////////////////////////////
+		virtual void setPointCount(size_t numOfPoints) override;
+		///////////////////////////////////////////////////////////
+		/// Method setFillColor() will set the background color of
+		/// the LiveGraph.
+		/// @param Color color: New color.
+		///////////////////////////////////////////////////////////
+		virtual void setFillColor(Color color) override;
+		///////////////////////////////////////////////////////////
+		/// Method setLineColor() will set the color of the lines
+		/// of series 0.
+		/// @param Color color: New color.
+		///////////////////////////////////////////////////////////
+		virtual void setLineColor(Color color) override;
+		///////////////////////////////////////////////////////////
+		/// Method setPointThickness() will set the radius of the
+		/// points on the LiveGraph. Note: To disable it set the
+		/// thickness to 0.0.
+		/// @param float thickness: New radius of points in pixels.
+		///////////////////////////////////////////////////////////
+		virtual void setPointThickness(float thickness) override;
+		///////////////////////////////////////////////////////////
+		/// Method setPointColor() will change the color of the
+		/// points of series 0.
+		/// @param Color color: New color.
+		///////////////////////////////////////////////////////////
+		virtual void setPointColor(Color color) override;
+		///////////////////////////////////////////////////////////
+		/// Method setLineThickness() will set the width of the
+		/// lines connecting the points together.
+		/// @param float thickness: Width in pixels.
+		///////////////////////////////////////////////////////////
+		void setLineThickness(float thickness);
+
+		///////////////////////////////////////////////////////////
+		/// @returns float: Width of lines in pixels.
+		///////////////////////////////////////////////////////////
+		float getLineThickness() const;
+		///////////////////////////////////////////////////////////
+		/// @returns size_t: Number of submitted points dropped
+		///  because the producer queue was missing or full.
+		///////////////////////////////////////////////////////////
+		size_t getDroppedCount() const;
+		///////////////////////////////////////////////////////////
+		/// @returns size_t: Number of series.
+		///////////////////////////////////////////////////////////
+		size_t getSeriesCount() const;
+		///////////////////////////////////////////////////////////
+		/// @param const std::string& name: Name of series.
+		/// @returns size_t: Index of the first series with the
+		///  name or getSeriesCount() if there is none.
+		///////////////////////////////////////////////////////////
+		size_t findSeries(const std::string& name) const;
+		///////////////////////////////////////////////////////////
+		/// @param size_t series: Index of series.
+		/// @returns const std::string&: Name of series.
+		///////////////////////////////////////////////////////////
+		const std::string& getSeriesName(size_t series) const;
+		///////////////////////////////////////////////////////////
+		/// @param size_t series: Index of series.
+		/// @returns Color: Color of series lines.
+		///////////////////////////////////////////////////////////
+		Color getSeriesColor(size_t series) const;
+		///////////////////////////////////////////////////////////
+		/// @param size_t series: Index of series.
+		/// @returns const util::RingBuffer<float>&: Points of the
+		///  series from oldest to newest. Empty points are NaN.
+		///////////////////////////////////////////////////////////
+		const util::RingBuffer<float>& getPoints(size_t series = 0) const;
+	protected:
+		///////////////////////////////////////////////////////////
+		/// struct Series is the storage of one series. Every
+		/// member is indexed the same way as samples.
+		///////////////////////////////////////////////////////////
+		struct Series {
+			/// Name of series.
+			std::string name;
+			/// Color of series. Unused for series 0.
+			Color color;
+			/// Points of series.
+			util::RingBuffer<float> samples;
+			/// Minimum and maximum of samples.
+			util::SlidingWindowMinMax<float> extrema;
+			/// Multi resolution minimum and maximum of samples.
+			util::MinMaxPyramid pyramid;
+			/// Number of points graphed since the last update().
+			size_t pending = 0;
+		};
+		///////////////////////////////////////////////////////////
+		/// struct QueuedPoint is a point waiting in the producer
+		/// queue.
+		///////////////////////////////////////////////////////////
+		struct QueuedPoint {
+			size_t series;
+			float value;
+		};
+
+		/// Every series. Series 0 always exists.
+		vector<Series> series;
+		/// Circular texture the LiveGraph is drawn onto. It is one
+		/// point spacing wider than the LiveGraph so the column
+		/// being cleared is never visible.
+		sf::RenderTexture scrollTexture;
+		/// Size of scrollTexture in pixels.
+		Vec2u scrollTextureSize;
+		/// Texture xpos of the newest point.
+		float headX = 0.0f;
+		/// Number of points of each series drawn on scrollTexture.
+		size_t drawnSamples = 0;
+		/// Number of points added to every series since the last
+		/// update().
+		size_t pendingSamples = 0;
+		/// True if the whole texture must be redrawn.
+		bool fullRedraw = true;
+		/// Width of lines in pixels.
+		float lineThickness = 1.0f;
+		/// Decimation used for the last redraw.
+		Decimation drawnDecimation = Decimation::None;
+		/// Texture positions of the points being drawn.
+		vector<Vec2f> meshPoints;
+		/// Triangle strip of the lines being drawn.
+		sf::VertexArray lineMesh;
+		/// Triangles of the points being drawn.
+		sf::VertexArray pointMesh;
+		/// Queue for a single producer thread.
+		std::unique_ptr<util::SpscQueue<QueuedPoint>> spscQueue;
+		/// Queue for multiple producer threads.
+		std::unique_ptr<util::MpscQueue<QueuedPoint>> mpscQueue;
+		/// Number of submitted points dropped.
+		std::atomic<size_t> droppedCount{ 0 };
+
+		///////////////////////////////////////////////////////////
+		/// Method addPoint() will add a point to a series.
+		/// @param Series& target: Series to add to.
+		/// @param float value: Height value of point.
+		///////////////////////////////////////////////////////////
+		void addPoint(Series& target, float value);
+		///////////////////////////////////////////////////////////
+		/// Method alignSeries() will pad every series to the same
+		/// number of new points and move the count to
+		/// pendingSamples.
+		///////////////////////////////////////////////////////////
+		virtual void alignSeries();
+		///////////////////////////////////////////////////////////
+		/// Method updateBounds() will adjust the bounds to the
+		/// stored points if auto adjusting is enabled.
+		///////////////////////////////////////////////////////////
+		virtual void updateBounds();
+		///////////////////////////////////////////////////////////
+		/// Method drainProducerQueue() will graph the points
+		/// waiting in the producer queue. At most one queue
+		/// capacity of points is taken per call so a fast producer
+		/// can't stall update(). The rest wait for the next call.
+		///////////////////////////////////////////////////////////
+		virtual void drainProducerQueue();
+		///////////////////////////////////////////////////////////
+		/// Method redrawTexture() will clear scrollTexture and
+		/// draw every stored point onto it.
+		///////////////////////////////////////////////////////////
+		virtual void redrawTexture();
+		///////////////////////////////////////////////////////////
+		/// Method drawSamples() will advance the head of
+		/// scrollTexture and draw the newest points onto it.
+		/// @param size_t first: Index of first new point in
+		///  samples. Must be at least 1.
+		///////////////////////////////////////////////////////////
+		virtual void drawSamples(size_t first);
+		///////////////////////////////////////////////////////////
+		/// Method decimateMinMax() will fill meshPoints with the
+		/// minimum and maximum of every pixel column.
+		/// @param const Series& source: Series to decimate.
+		///////////////////////////////////////////////////////////
+		virtual void decimateMinMax(const Series& source);
+		///////////////////////////////////////////////////////////
+		/// Method decimateLTTB() will fill meshPoints using
+		/// Largest-Triangle-Three-Buckets. The candidates of each
+		/// bucket are the extrema of its quarters, found with the
+		/// pyramid, instead of every point in the bucket.
+		/// @param const Series& source: Series to decimate.
+		///////////////////////////////////////////////////////////
+		virtual void decimateLTTB(const Series& source);
+
+		///////////////////////////////////////////////////////////
+		/// @returns bool: True if the points are decimated.
+		///////////////////////////////////////////////////////////
+		bool isDecimating() const;
+		///////////////////////////////////////////////////////////
+		/// @returns float: Horizontal distance between points.
+		///////////////////////////////////////////////////////////
+		float getSpacing() const;
+		///////////////////////////////////////////////////////////
+		/// @param float value: Height value of a point.
+		/// @returns float: Texture ypos of the value.
+		///////////////////////////////////////////////////////////
+		float mapValue(float value) const;
+		///////////////////////////////////////////////////////////
+		/// @param size_t series: Index of series.
+		/// @returns Color: Color of series points.
+		///////////////////////////////////////////////////////////
+		Color getSeriesPointColor(size_t series) const;
+		///////////////////////////////////////////////////////////
+		/// Method forEachWrap() will call a function once for
+		/// every copy of a horizontal span needed to draw it onto
+		/// the circular scrollTexture.
+		/// @param float left: Left of the span.
+		/// @param float right: Right of the span.
+		/// @param Function function: Called with the xoffset of
+		///  each copy.
+		///////////////////////////////////////////////////////////
+		template <typename Function>
+		void forEachWrap(float left, float right, Function function);
+		///////////////////////////////////////////////////////////
+		/// Method clearColumn() will fill a column of scrollTexture
+		/// with the background color.
+		/// @param float xpos: Left of the column.
+		/// @param float width: Width of the column.
+		///////////////////////////////////////////////////////////
+		void clearColumn(float xpos, float width);
+		///////////////////////////////////////////////////////////
+		/// Method appendSeries() will add a run of points of a
+		/// series, ending at the newest point, to the meshes. The
+		/// lines are broken at empty points.
+		/// @param size_t index: Index of series.
+		/// @param size_t first: Index of first point in samples.
+		/// @param float xpos: Texture xpos of first point.
+		///////////////////////////////////////////////////////////
+		void appendSeries(size_t index, size_t first, float xpos);
+		///////////////////////////////////////////////////////////
+		/// Method drawMeshes() will draw the meshes onto
+		/// scrollTexture.
+		/// @param float left: Texture xpos of first point.
+		/// @param float right: Texture xpos of last point.
+		///////////////////////////////////////////////////////////
+		void drawMeshes(float left, float right);
+	};
+
+	///////////////////////////////////////////////////////////
+	/// LiveGraph
+	///////////////////////////////////////////////////////////
+
+	inline LiveGraph::LiveGraph() {
+		addSeries("", lineColor);
+	}
+
+	inline void LiveGraph::update() {
+		GLASS_PROFILE_ZONE("LiveGraph::update");
+
+		if (locked)
+			return;
+
+		drainProducerQueue();
+		alignSeries();
+
+		if (pendingSamples > 0)
+			updateBounds();
+
+		const Vec2f size = getSize();
+		const Vec2u textureSize(
+			static_cast<unsigned>(std::ceil(size.x + getSpacing())) + 1u,
+			static_cast<unsigned>(std::ceil(size.y))
+		);
+
+		if (textureSize != scrollTextureSize) {
+			scrollTextureSize = textureSize;
+			scrollTexture.create(textureSize.x, textureSize.y);
+			fullRedraw = true;
+		}
+
+		if (decimation != drawnDecimation) {
+			drawnDecimation = decimation;
+			fullRedraw = true;
+		}
+
+		// Decimated points depend on every point in their bucket
+		// so they are always redrawn. The cost depends on the width.
+		const size_t count = series[0].samples.size();
+		if (fullRedraw || pendingSamples >= count
+			|| (pendingSamples > 0 && isDecimating()))
+			redrawTexture();
+		else if (pendingSamples > 0) {
+			drawSamples(count - pendingSamples);
+			pendingSamples = 0;
+			scrollTexture.display();
+		}
+	}
+	inline void LiveGraph::render(
+		sf::RenderTarget* target,
+		sf::RenderStates renderStates
+	) {
+		GLASS_PROFILE_ZONE("LiveGraph::render");
+
+		const Vec2f position = getPosition();
+		const Vec2f size = getSize();
+
+		sf::RectangleShape outline(size);
+		outline.setPosition(position);
+		outline.setFillColor(Color::Transparent);
+		outline.setOutlineColor(outlineColor);
+		outline.setOutlineThickness(outlineThickness);
+		target->draw(outline, renderStates);
+
+		if (scrollTextureSize.x == 0 || scrollTextureSize.y == 0)
+			return;
+
+		// The view starts at the oldest point so the LiveGraph fills
+		// from the left before it starts scrolling.
+		const float textureWidth = static_cast<float>(scrollTextureSize.x);
+		const size_t shown = drawnSamples == 0 ? 0 : drawnSamples - 1;
+		float left = headX - shown * getSpacing();
+		if (left < 0.0f)
+			left += textureWidth;
+
+		// Draw the circular texture as up to two quads split at the seam.
+		const float firstWidth = std::fmin(size.x, textureWidth - left);
+		const float spans[2][3] = {
+			{ 0.0f, firstWidth, left },
+			{ firstWidth, size.x, 0.0f }
+		};
+
+		sf::Vertex vertices[12];
+		size_t vertexCount = 0;
+
+		for (const float* span : spans) {
+			if (span[1] <= span[0])
+				continue;
+
+			const float x0 = position.x + span[0], x1 = position.x + span[1];
+			const float u0 = span[2], u1 = span[2] + span[1] - span[0];
+			const float y0 = position.y, y1 = position.y + size.y;
+			const float v1 = size.y;
+
+			vertices[vertexCount++] = sf::Vertex(Vec2f(x0, y0), Vec2f(u0, 0.0f));
+			vertices[vertexCount++] = sf::Vertex(Vec2f(x1, y0), Vec2f(u1, 0.0f));
+			vertices[vertexCount++] = sf::Vertex(Vec2f(x1, y1), Vec2f(u1, v1));
+			vertices[vertexCount++] = sf::Vertex(Vec2f(x0, y0), Vec2f(u0, 0.0f));
+			vertices[vertexCount++] = sf::Vertex(Vec2f(x1, y1), Vec2f(u1, v1));
+			vertices[vertexCount++] = sf::Vertex(Vec2f(x0, y1), Vec2f(u0, v1));
+		}
+
+		renderStates.texture = &scrollTexture.getTexture();
+		target->draw(vertices, vertexCount, sf::Triangles, renderStates);
+	}
+
+	inline void LiveGraph::graph(float value) {
+		addPoint(series[0], value);
+	}
+	inline void LiveGraph::graph(size_t series, float value) {
+		if (series < this->series.size())
+			addPoint(this->series[series], value);
+	}
+	inline void LiveGraph::clear() {
+		for (Series& current : series) {
+			current.samples.clear();
+			current.extrema.clear();
+			current.pyramid.clear();
+			current.pending = 0;
+		}
+		pendingSamples = 0;
+		fullRedraw = true;
+	}
+	inline bool LiveGraph::submit(float value) {
+		return submit(0, value);
+	}
+	inline bool LiveGraph::submit(size_t series, float value) {
+		const QueuedPoint point = { series, value };
+		bool queued = false;
+
+		if (spscQueue != nullptr)
+			queued = spscQueue->push(point);
+		else if (mpscQueue != nullptr)
+			queued = mpscQueue->push(point);
+
+		if (!queued)
+			droppedCount.fetch_add(1, std::memory_order_relaxed);
+		return queued;
+	}
+	inline void LiveGraph::setProducerQueue(size_t capacity, bool multipleProducers) {
+		spscQueue.reset();
+		mpscQueue.reset();
+
+		if (multipleProducers)
+			mpscQueue.reset(new util::MpscQueue<QueuedPoint>(capacity));
+		else
+			spscQueue.reset(new util::SpscQueue<QueuedPoint>(capacity));
+	}
+	inline void LiveGraph::redraw() {
+		fullRedraw = true;
+	}
+
+	inline size_t LiveGraph::addSeries(const std::string& name, Color color) {
+		series.emplace_back();
+
+		Series& added = series.back();
+		added.name = name;
+		added.color = color;
+		added.samples.setCapacity(numOfPoints);
+		added.extrema.setWindowSize(numOfPoints);
+		added.pyramid.setCapacity(numOfPoints);
+
+		// Line the new series up with the points already drawn.
+		for (size_t i = 0; i < series[0].samples.size(); i++)
+			addPoint(added, std::numeric_limits<float>::quiet_NaN());
+		added.pending = 0;
+
+		fullRedraw = true;
+		return series.size() - 1;
+	}
+	inline void LiveGraph::setSeriesColor(size_t series, Color color) {
+		if (series == 0)
+			setLineColor(color);
+		else if (series < this->series.size()) {
+			this->series[series].color = color;
+			fullRedraw = true;
+		}
+	}
+
+	inline void LiveGraph::applyStyle(const Style& style) {
+		Graph::applyStyle(style);
+		fullRedraw = true;
+	}
+	inline void LiveGraph::setSize(Vec2f size) {
+		Graph::setSize(size);
+		fullRedraw = true;
+	}
+	inline void LiveGraph::setSize(float width, float height) {
+		setSize(Vec2f(width, height));
+	}
+	inline void LiveGraph::setLowerBound(float height) {
+		Graph::setLowerBound(height);
+		fullRedraw = true;
+	}
+	inline void LiveGraph::setUpperBound(float height) {
+		Graph::setUpperBound(height);
+		fullRedraw = true;
+	}
+	inline void LiveGraph::setPointCount(size_t numOfPoints) {
+		Graph::setPointCount(numOfPoints);
+
+		for (Series& current : series) {
+			current.samples.setCapacity(numOfPoints);
+			current.extrema.setWindowSize(numOfPoints);
+			current.pyramid.setCapacity(numOfPoints);
+
+			for (size_t i = 0; i < current.samples.size(); i++) {
+				current.extrema.push(current.samples[i]);
+				current.pyramid.push(current.samples[i]);
+			}
+		}
+		fullRedraw = true;
+	}
+	inline void LiveGraph::setFillColor(Color color) {
+		Graph::setFillColor(color);
+		fullRedraw = true;
+	}
+	inline void LiveGraph::setLineColor(Color color) {
+		Graph::setLineColor(color);
+		fullRedraw = true;
+	}
+	inline void LiveGraph::setPointThickness(float thickness) {
+		Graph::setPointThickness(thickness);
+		fullRedraw = true;
+	}
+	inline void LiveGraph::setPointColor(Color color) {
+		Graph::setPointColor(color);
+		fullRedraw = true;
+	}
+	inline void LiveGraph::setLineThickness(float thickness) {
+		lineThickness = thickness;
+		fullRedraw = true;
+	}
+
+	inline float LiveGraph::getLineThickness() const {
+		return lineThickness;
+	}
+	inline size_t LiveGraph::getDroppedCount() const {
+		return droppedCount.load(std::memory_order_relaxed);
+	}
+	inline size_t LiveGraph::getSeriesCount() const {
+		return series.size();
+	}
+	inline size_t LiveGraph::findSeries(const std::string& name) const {
+		for (size_t i = 0; i < series.size(); i++) {
+			if (series[i].name == name)
+				return i;
+		}
+		return series.size();
+	}
+	inline const std::string& LiveGraph::getSeriesName(size_t series) const {
+		return this->series[series].name;
+	}
+	inline Color LiveGraph::getSeriesColor(size_t series) const {
+		return series == 0 ? lineColor : this->series[series].color;
+	}
+	inline const util::RingBuffer<float>& LiveGraph::getPoints(size_t series) const {
+		return this->series[series].samples;
+	}
+
+	inline void LiveGraph::addPoint(Series& target, float value) {
+		target.samples.push(value);
+		target.extrema.push(value);
+		target.pyramid.push(value);
+		target.pending++;
+	}
+	inline void LiveGraph::alignSeries() {
+		size_t newest = 0;
+		for (const Series& current : series)
+			newest = current.pending > newest ? current.pending : newest;
+
+		// Hold the last point of series that fell behind.
+		for (Series& current : series) {
+			while (current.pending < newest) {
+				addPoint(current, current.samples.empty()
+					? std::numeric_limits<float>::quiet_NaN()
+					: current.samples.back());
+			}
+			current.pending = 0;
+		}
+
+		pendingSamples += newest;
+	}
+	inline void LiveGraph::updateBounds() {
+		bool found = false;
+		float minimum = 0.0f, maximum = 0.0f;
+
+		for (const Series& current : series) {
+			if (current.extrema.empty())
+				continue;
+
+			if (!found || current.extrema.getMin() < minimum)
+				minimum = current.extrema.getMin();
+			if (!found || current.extrema.getMax() > maximum)
+				maximum = current.extrema.getMax();
+			found = true;
+		}
+
+		if (!found)
+			return;
+
+		if (autoAdjustLower && minimum != lowerBound) {
+			lowerBound = minimum;
+			fullRedraw = true;
+		}
+		if (autoAdjustUpper && maximum != upperBound) {
+			upperBound = maximum;
+			fullRedraw = true;
+		}
+	}
+	inline void LiveGraph::drainProducerQueue() {
+		QueuedPoint batch[256];
+		size_t count;
+		size_t remaining = spscQueue != nullptr ? spscQueue->capacity()
+			: mpscQueue != nullptr ? mpscQueue->capacity() : 0;
+
+		do {
+			const size_t wanted = std::min<size_t>(remaining, 256);
+
+			if (spscQueue != nullptr)
+				count = spscQueue->popBulk(batch, wanted);
+			else if (mpscQueue != nullptr)
+				count = mpscQueue->popBulk(batch, wanted);
+			else
+				count = 0;
+
+			for (size_t i = 0; i < count; i++)
+				graph(batch[i].series, batch[i].value);
+			remaining -= count;
+		} while (count == 256 && remaining > 0);
+	}
+	inline void LiveGraph::redrawTexture() {
+		const float spacing = getSpacing();
+		const size_t count = series[0].samples.size();
+
+		scrollTexture.clear(backGroundColor);
+
+		// Start over with the oldest point on the left edge.
+		headX = count == 0
+			? scrollTextureSize.x - spacing
+			: (count - 1) * spacing;
+
+		lineMesh.clear();
+		pointMesh.clear();
+
+		for (size_t i = 0; i < series.size(); i++) {
+			if (isDecimating()) {
+				if (decimation == Decimation::MinMax)
+					decimateMinMax(series[i]);
+				else
+					decimateLTTB(series[i]);
+
+				priv::appendPolyline(
+					lineMesh, meshPoints.data(), meshPoints.size(),
+					lineThickness, getSeriesColor(i)
+				);
+			}
+			else
+				appendSeries(i, 0, 0.0f);
+		}
+
+		drawMeshes(0.0f, headX);
+
+		scrollTexture.display();
+		drawnSamples = count;
+		pendingSamples = 0;
+		fullRedraw = false;
+	}
+	inline void LiveGraph::drawSamples(size_t first) {
+		const float spacing = getSpacing();
+		const float previousX = headX;
+		const size_t count = series[0].samples.size() - first;
+
+		headX = previousX + count * spacing;
+		if (headX >= scrollTextureSize.x)
+			headX -= scrollTextureSize.x;
+
+		// Clear from the previous point up to the left edge of the
+		// view. Everything right of the newest point is off screen.
+		// The edge is rounded down to a whole pixel so the column of
+		// the oldest point, which can be partly visible, is kept.
+		const float textureWidth = static_cast<float>(scrollTextureSize.x);
+		const float newX = previousX + count * spacing;
+		float oldestX = headX - (series[0].samples.size() - 1) * spacing;
+		while (oldestX <= previousX)
+			oldestX += textureWidth;
+
+		const float clearRight = std::floor(std::fmin(
+			oldestX, newX + textureWidth - getSize().x));
+		clearColumn(previousX, std::fmax(clearRight, newX) - previousX);
+
+		// Start at the previous point to connect the new lines and
+		// redraw its marker, which was partly cleared.
+		lineMesh.clear();
+		pointMesh.clear();
+
+		for (size_t i = 0; i < series.size(); i++)
+			appendSeries(i, first - 1, previousX);
+
+		drawMeshes(previousX, previousX + count * spacing);
+		drawnSamples = series[0].samples.size();
+	}
+	inline void LiveGraph::decimateMinMax(const Series& source) {
+		const float spacing = getSpacing();
+		const util::RingBuffer<float>& samples = source.samples;
+		const size_t count = samples.size();
+		const size_t columns = static_cast<size_t>(std::ceil(count * spacing)) + 1;
+
+		meshPoints.clear();
+
+		for (size_t column = 0; column < columns; column++) {
+			const size_t first = column * count / columns;
+			const size_t last = (column + 1) * count / columns;
+			if (first == last)
+				continue;
+
+			const util::MinMaxPyramid::Extrema range = source.pyramid.query(samples, first, last);
+			if (range.min > range.max)
+				continue;
+
+			// Keep the minimum and maximum in the order they were graphed.
+			size_t a = source.pyramid.toIndex(samples, range.minIndex);
+			size_t b = source.pyramid.toIndex(samples, range.maxIndex);
+			if (a > b)
+				std::swap(a, b);
+
+			meshPoints.push_back(Vec2f(a * spacing, mapValue(samples[a])));
+			if (a != b)
+				meshPoints.push_back(Vec2f(b * spacing, mapValue(samples[b])));
+		}
+	}
+	inline void LiveGraph::decimateLTTB(const Series& source) {
+		const float spacing = getSpacing();
+		const util::RingBuffer<float>& samples = source.samples;
+		const size_t count = samples.size();
+		const size_t buckets = 2 * static_cast<size_t>(std::ceil(count * spacing));
+
+		meshPoints.clear();
+
+		auto pointAt = [&](size_t index) {
+			return Vec2f(index * spacing, mapValue(samples[index]));
+		};
+		auto bucketStart = [&](size_t bucket) {
+			return 1 + bucket * (count - 2) / buckets;
+		};
+
+		if (count < 3 || buckets < 1) {
+			for (size_t i = 0; i < count; i++) {
+				if (samples[i] == samples[i])
+					meshPoints.push_back(pointAt(i));
+			}
+			return;
+		}
+
+		if (samples[0] == samples[0])
+			meshPoints.push_back(pointAt(0));
+
+		for (size_t bucket = 0; bucket < buckets; bucket++) {
+			const size_t first = bucketStart(bucket), last = bucketStart(bucket + 1);
+			if (first == last)
+				continue;
+
+			// The third point is the center of the next bucket.
+			Vec2f next = pointAt(count - 1);
+			if (bucket + 1 < buckets) {
+				const size_t nextLast = bucketStart(bucket + 2);
+				const util::MinMaxPyramid::Extrema range =
+					source.pyramid.query(samples, last, nextLast);
+				if (range.min <= range.max)
+					next = Vec2f((last + nextLast) * spacing / 2.0f,
+						mapValue((range.min + range.max) / 2.0f));
+			}
+
+			const Vec2f previous = meshPoints.empty() ? next : meshPoints.back();
+			float bestArea = -1.0f;
+			Vec2f best;
+
+			for (size_t quarter = 0; quarter < 4; quarter++) {
+				const size_t quarterFirst = first + quarter * (last - first) / 4;
+				const size_t quarterLast = first + (quarter + 1) * (last - first) / 4;
+				if (quarterFirst == quarterLast)
+					continue;
+
+				const util::MinMaxPyramid::Extrema range =
+					source.pyramid.query(samples, quarterFirst, quarterLast);
+				if (range.min > range.max)
+					continue;
+
+				for (size_t pushIndex : { range.minIndex, range.maxIndex }) {
+					const Vec2f candidate = pointAt(source.pyramid.toIndex(samples, pushIndex));
+					const float area = std::fabs(
+						(previous.x - next.x) * (candidate.y - previous.y)
+						- (previous.x - candidate.x) * (next.y - previous.y)
+					);
+
+					if (area > bestArea) {
+						bestArea = area;
+						best = candidate;
+					}
+				}
+			}
+
+			if (bestArea >= 0.0f)
+				meshPoints.push_back(best);
+		}
+
+		if (samples[count - 1] == samples[count - 1])
+			meshPoints.push_back(pointAt(count - 1));
+	}
+
+	inline bool LiveGraph::isDecimating() const {
+		return decimation != Decimation::None && getSpacing() < 0.5f;
+	}
+	inline float LiveGraph::getSpacing() const {
+		return getSize().x / (numOfPoints > 1 ? numOfPoints - 1 : 1);
+	}
+	inline float LiveGraph::mapValue(float value) const {
+		const float range = upperBound - lowerBound;
+		const float height = static_cast<float>(scrollTextureSize.y);
+
+		if (range == 0.0f)
+			return height / 2.0f;
+		return (upperBound - value) / range * height;
+	}
+	inline Color LiveGraph::getSeriesPointColor(size_t series) const {
+		return series == 0 ? pointColor : this->series[series].color;
+	}
+	template <typename Function>
+	inline void LiveGraph::forEachWrap(float left, float right, Function function) {
+		const float width = static_cast<float>(scrollTextureSize.x);
+
+		function(0.0f);
+		if (left < 0.0f)
+			function(width);
+		if (right > width)
+			function(-width);
+	}
+	inline void LiveGraph::clearColumn(float xpos, float width) {
+		sf::RectangleShape column(Vec2f(width, static_cast<float>(scrollTextureSize.y)));
+		column.setFillColor(backGroundColor);
+
+		forEachWrap(xpos, xpos + width, [&](float offset) {
+			column.setPosition(xpos + offset, 0.0f);
+			scrollTexture.draw(column, sf::RenderStates(sf::BlendNone));
+		});
+	}
+	inline void LiveGraph::appendSeries(size_t index, size_t first, float xpos) {
+		const util::RingBuffer<float>& samples = series[index].samples;
+		const float spacing = getSpacing();
+		const Color color = getSeriesColor(index);
+
+		// Join the first line to the one before it.
+		Vec2f before;
+		bool hasBefore = first > 0 && samples[first - 1] == samples[first - 1];
+		if (hasBefore)
+			before = Vec2f(xpos - spacing, mapValue(samples[first - 1]));
+
+		meshPoints.clear();
+
+		for (size_t i = first; i <= samples.size(); i++) {
+			if (i < samples.size() && samples[i] == samples[i]) {
+				meshPoints.push_back(Vec2f(xpos + (i - first) * spacing, mapValue(samples[i])));
+				continue;
+			}
+
+			// An empty point or the end finishes a run.
+			priv::appendPolyline(
+				lineMesh, meshPoints.data(), meshPoints.size(),
+				lineThickness, color, hasBefore ? &before : nullptr
+			);
+			priv::appendMarkers(
+				pointMesh, meshPoints.data(), meshPoints.size(),
+				pointThickness, getSeriesPointColor(index)
+			);
+
+			meshPoints.clear();
+			hasBefore = false;
+		}
+	}
+	inline void LiveGraph::drawMeshes(float left, float right) {
+		const float margin = std::fmax(lineThickness, pointThickness);
+
+		forEachWrap(left - margin, right + margin, [&](float offset) {
+			sf::RenderStates states;
+			states.transform.translate(offset, 0.0f);
+
+			scrollTexture.draw(lineMesh, states);
+			scrollTexture.draw(pointMesh, states);
+		});
+	}
+}
\ No newline at end of file
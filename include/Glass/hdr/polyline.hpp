@@ -0,0 +1,134 @@
+#pragma once
+
+// Dependencies
+#include <cmath>
+
+#include "typedef.hpp"
+
+namespace gs {
+	namespace priv {
+		///////////////////////////////////////////////////////////
+		/// Function appendPolyline() will append a thick line
+		/// through a list of points to a triangle strip. The
+		/// segments are joined with miters which are clamped to
+		/// twice the thickness on sharp turns. Several lines can
+		/// share one strip, they are separated by degenerate
+		/// triangles.
+		/// @param sf::VertexArray& strip: Output mesh. Clear it
+		///  before the first line so its memory is reused.
+		/// @param const Vec2f* points: Points of the line.
+		/// @param size_t count: Number of points.
+		/// @param float thickness: Width of the line in pixels.
+		/// @param Color color: Color of the line.
+		/// @param const Vec2f* before: Optional point before the
+		///  first point. If given the first point is joined as if
+		///  the line continued from it.
+		///////////////////////////////////////////////////////////
+		inline void appendPolyline(
+			sf::VertexArray& strip,
+			const Vec2f* points, size_t count,
+			float thickness, Color color,
+			const Vec2f* before = nullptr
+		) {
+			strip.setPrimitiveType(sf::TriangleStrip);
+
+			if (count < 2 || thickness <= 0.0f)
+				return;
+
+			// Repeat the last vertex here and the first vertex of this
+			// line below so the triangles between the lines are empty.
+			const bool separate = strip.getVertexCount() > 0;
+			if (separate)
+				strip.append(strip[strip.getVertexCount() - 1]);
+
+			const float halfThickness = thickness / 2.0f;
+			const float miterLimit = thickness;
+
+			auto direction = [](Vec2f from, Vec2f to, Vec2f fallback) {
+				const Vec2f delta = to - from;
+				const float length = std::sqrt(delta.x * delta.x + delta.y * delta.y);
+				return length > 0.0f ? delta / length : fallback;
+			};
+
+			Vec2f incoming = direction(points[0], points[1], Vec2f(1.0f, 0.0f));
+			if (before != nullptr)
+				incoming = direction(*before, points[0], incoming);
+
+			for (size_t i = 0; i < count; i++) {
+				const Vec2f outgoing = i + 1 < count
+					? direction(points[i], points[i + 1], incoming)
+					: incoming;
+
+				// The miter is along the average normal, lengthened so
+				// both segments keep their full thickness.
+				const Vec2f normal(-incoming.y, incoming.x);
+				Vec2f miter(-(incoming.y + outgoing.y), incoming.x + outgoing.x);
+				const float miterLength = std::sqrt(miter.x * miter.x + miter.y * miter.y);
+				miter = miterLength > 0.0f ? miter / miterLength : normal;
+
+				const float cosine = miter.x * normal.x + miter.y * normal.y;
+				float extent = cosine > 0.0f ? halfThickness / cosine : miterLimit;
+				if (extent > miterLimit)
+					extent = miterLimit;
+
+				if (i == 0 && separate)
+					strip.append(sf::Vertex(points[i] + miter * extent, color));
+				strip.append(sf::Vertex(points[i] + miter * extent, color));
+				strip.append(sf::Vertex(points[i] - miter * extent, color));
+
+				incoming = outgoing;
+			}
+		}
+
+		///////////////////////////////////////////////////////////
+		/// Function getUnitCircle() will return points around a
+		/// unit circle. The points are computed once.
+		/// @returns const Vec2f*: Array of 16 points.
+		///////////////////////////////////////////////////////////
+		inline const Vec2f* getUnitCircle() {
+			struct UnitCircle {
+				Vec2f points[16];
+
+				UnitCircle() {
+					for (unsigned int i = 0; i < 16; i++) {
+						const float angle = i * 6.28318530718f / 16;
+						points[i] = Vec2f(std::cos(angle), std::sin(angle));
+					}
+				}
+			};
+			static const UnitCircle circle;
+			return circle.points;
+		}
+
+		///////////////////////////////////////////////////////////
+		/// Function appendMarkers() will append a filled circle at
+		/// every point to a triangle mesh.
+		/// @param sf::VertexArray& triangles: Output mesh. Clear it
+		///  before the first call so its memory is reused.
+		/// @param const Vec2f* points: Centers of the circles.
+		/// @param size_t count: Number of points.
+		/// @param float radius: Radius of the circles in pixels.
+		/// @param Color color: Color of the circles.
+		///////////////////////////////////////////////////////////
+		inline void appendMarkers(
+			sf::VertexArray& triangles,
+			const Vec2f* points, size_t count,
+			float radius, Color color
+		) {
+			triangles.setPrimitiveType(sf::Triangles);
+
+			if (radius <= 0.0f)
+				return;
+
+			const Vec2f* circle = getUnitCircle();
+
+			for (size_t i = 0; i < count; i++) {
+				for (unsigned int j = 0; j < 16; j++) {
+					triangles.append(sf::Vertex(points[i], color));
+					triangles.append(sf::Vertex(points[i] + circle[j] * radius, color));
+					triangles.append(sf::Vertex(points[i] + circle[(j + 1) % 16] * radius, color));
+				}
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,338 @@
+#pragma once
+
+// Dependencies
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "menu.hpp"
+#include "textbox.hpp"
+#include "liveGraph.hpp"
+#include "transition.hpp"
+#include "buttonAccess.hpp"
+#include "sliderAccess.hpp"
+#include "input/key.hpp"
+#include "util/profiler.hpp"
+
+namespace gs {
+	///////////////////////////////////////////////////////////
+	/// class RedrawTracker decides if a frame looks different
+	/// from the last drawn one, so a static UI doesn't have to
+	/// be rendered every frame. Every frame it fingerprints
+	/// what the tracked Components and Transitions would draw,
+	/// which catches input, running animations and setter
+	/// calls alike. Example:
+	///
+	/// while (window.pollEvent(event))
+	/// 	redraw.processEvent(event);
+	/// gs::input::updateInputs();
+	/// menu.update();
+	///
+	/// clock.setIdle(redraw.isIdle());
+	/// if (redraw.needsRedraw()) {
+	/// 	window.clear();
+	/// 	menu.render(&window);
+	/// 	window.display();
+	/// }
+	///
+	/// Graph doesn't expose its points, call invalidate() when
+	/// graphing to one. LiveGraph is fingerprinted.
+	///////////////////////////////////////////////////////////
+	class RedrawTracker {
+	public:
+		RedrawTracker() = default;
+		~RedrawTracker() = default;
+
+		///////////////////////////////////////////////////////////
+		/// Method track() will add a Component to fingerprint.
+		/// Menus include all of their Components.
+		/// @param Component& component: Component to track.
+		///////////////////////////////////////////////////////////
+		void track(Component& component);
+		///////////////////////////////////////////////////////////
+		/// Method track() will add a Transition to fingerprint.
+		/// @param Transition& transition: Transition to track.
+		///////////////////////////////////////////////////////////
+		void track(Transition& transition);
+		///////////////////////////////////////////////////////////
+		/// Method untrack() will stop tracking a Component.
+		/// @param Component& component: Component to remove.
+		///////////////////////////////////////////////////////////
+		void untrack(Component& component);
+		///////////////////////////////////////////////////////////
+		/// Method untrack() will stop tracking a Transition.
+		/// @param Transition& transition: Transition to remove.
+		///////////////////////////////////////////////////////////
+		void untrack(Transition& transition);
+
+		///////////////////////////////////////////////////////////
+		/// Method processEvent() will pass an event on to
+		/// gs::input::updateEvents(). Every event except mouse
+		/// movement forces a redraw, since resizing or regaining
+		/// focus can need one without any Component changing.
+		/// Mouse movement only redraws if it changes a Component.
+		/// @param sf::Event& event: Event from pollEvent().
+		///////////////////////////////////////////////////////////
+		void processEvent(sf::Event& event);
+		///////////////////////////////////////////////////////////
+		/// Method invalidate() will force redraws. Use it for
+		/// anything drawn that isn't tracked.
+		/// @param unsigned int frames: Number of frames to redraw.
+		///////////////////////////////////////////////////////////
+		void invalidate(unsigned int frames = 1);
+		///////////////////////////////////////////////////////////
+		/// Method needsRedraw() will check if the frame has to be
+		/// rendered. Call it once per frame after updating.
+		/// @returns bool: True if the frame should be rendered.
+		///////////////////////////////////////////////////////////
+		bool needsRedraw();
+		///////////////////////////////////////////////////////////
+		/// Method setIdleDelay() will set how many frames without a
+		/// redraw it takes to become idle. By default it is 30.
+		/// @param unsigned int frames: Frames without a redraw.
+		///////////////////////////////////////////////////////////
+		void setIdleDelay(unsigned int frames);
+
+		///////////////////////////////////////////////////////////
+		/// @returns bool: True if nothing changed for the idle
+		///  delay. Pass it to util::PrecisionClock::setIdle().
+		///////////////////////////////////////////////////////////
+		bool isIdle() const;
+		///////////////////////////////////////////////////////////
+		/// @returns unsigned int: Frames without a redraw needed
+		///  to become idle.
+		///////////////////////////////////////////////////////////
+		unsigned int getIdleDelay() const;
+		///////////////////////////////////////////////////////////
+		/// @returns size_t: Number of frames needsRedraw() skipped.
+		///////////////////////////////////////////////////////////
+		size_t getSkippedFrames() const;
+	protected:
+		/// Tracked Components.
+		vector<Component*> components;
+		/// Tracked Transitions.
+		vector<Transition*> transitions;
+		/// Fingerprint of the last drawn frame.
+		std::uint64_t drawnFingerprint = 0;
+		/// Frames that have to be redrawn no matter what.
+		unsigned int forcedFrames = 1;
+		/// Frames in a row without a redraw.
+		unsigned int quietFrames = 0;
+		/// Frames without a redraw needed to become idle.
+		unsigned int idleDelay = 30;
+		/// Number of frames needsRedraw() skipped.
+		size_t skippedFrames = 0;
+
+		///////////////////////////////////////////////////////////
+		/// @returns std::uint64_t: Fingerprint of everything that
+		///  is tracked.
+		///////////////////////////////////////////////////////////
+		std::uint64_t fingerprint();
+		///////////////////////////////////////////////////////////
+		/// Method addComponent() will add what a Component draws to
+		/// a fingerprint.
+		/// @param std::uint64_t& hash: Fingerprint to add to.
+		/// @param Component& component: Component to add.
+		///////////////////////////////////////////////////////////
+		static void addComponent(std::uint64_t& hash, Component& component);
+		///////////////////////////////////////////////////////////
+		/// Method addBytes() will add bytes to a fingerprint using
+		/// FNV-1a.
+		/// @param std::uint64_t& hash: Fingerprint to add to.
+		/// @param const void* data: Bytes to add.
+		/// @param size_t size: Number of bytes.
+		///////////////////////////////////////////////////////////
+		static void addBytes(std::uint64_t& hash, const void* data, size_t size);
+		///////////////////////////////////////////////////////////
+		/// Method add() will add a value to a fingerprint.
+		/// @param std::uint64_t& hash: Fingerprint to add to.
+		/// @param const Type& value: Trivially copyable value.
+		///////////////////////////////////////////////////////////
+		template <typename Type>
+		static void add(std::uint64_t& hash, const Type& value);
+		///////////////////////////////////////////////////////////
+		/// Method add() will add a string to a fingerprint.
+		/// @param std::uint64_t& hash: Fingerprint to add to.
+		/// @param const std::string& string: String to add.
+		///////////////////////////////////////////////////////////
+		static void add(std::uint64_t& hash, const std::string& string);
+		///////////////////////////////////////////////////////////
+		/// Method add() will add a Hitbox to a fingerprint.
+		/// @param std::uint64_t& hash: Fingerprint to add to.
+		/// @param const Hitbox& hitbox: Hitbox to add.
+		///////////////////////////////////////////////////////////
+		static void add(std::uint64_t& hash, const Hitbox& hitbox);
+	};
+
+	///////////////////////////////////////////////////////////
+	/// RedrawTracker
+	///////////////////////////////////////////////////////////
+
+	inline void RedrawTracker::track(Component& component) {
+		if (std::find(components.begin(), components.end(), &component) == components.end())
+			components.push_back(&component);
+		invalidate();
+	}
+	inline void RedrawTracker::track(Transition& transition) {
+		if (std::find(transitions.begin(), transitions.end(), &transition) == transitions.end())
+			transitions.push_back(&transition);
+		invalidate();
+	}
+	inline void RedrawTracker::untrack(Component& component) {
+		components.erase(std::remove(components.begin(), components.end(), &component),
+			components.end());
+		invalidate();
+	}
+	inline void RedrawTracker::untrack(Transition& transition) {
+		transitions.erase(std::remove(transitions.begin(), transitions.end(), &transition),
+			transitions.end());
+		invalidate();
+	}
+
+	inline void RedrawTracker::processEvent(sf::Event& event) {
+		input::updateEvents(event);
+
+		if (event.type != sf::Event::MouseMoved)
+			invalidate();
+	}
+	inline void RedrawTracker::invalidate(unsigned int frames) {
+		forcedFrames = std::max(forcedFrames, frames);
+	}
+	inline bool RedrawTracker::needsRedraw() {
+		GLASS_PROFILE_ZONE("RedrawTracker::needsRedraw");
+
+		const std::uint64_t current = fingerprint();
+		const bool redraw = forcedFrames > 0 || current != drawnFingerprint;
+
+		drawnFingerprint = current;
+		if (forcedFrames > 0)
+			forcedFrames--;
+
+		if (redraw)
+			quietFrames = 0;
+		else {
+			if (quietFrames < idleDelay)
+				quietFrames++;
+			skippedFrames++;
+		}
+		return redraw;
+	}
+	inline void RedrawTracker::setIdleDelay(unsigned int frames) {
+		idleDelay = frames;
+	}
+
+	inline bool RedrawTracker::isIdle() const {
+		return quietFrames >= idleDelay;
+	}
+	inline unsigned int RedrawTracker::getIdleDelay() const {
+		return idleDelay;
+	}
+	inline size_t RedrawTracker::getSkippedFrames() const {
+		return skippedFrames;
+	}
+
+	inline std::uint64_t RedrawTracker::fingerprint() {
+		std::uint64_t hash = 14695981039346656037ull;
+
+		for (Component* component : components)
+			addComponent(hash, *component);
+
+		for (Transition* transition : transitions) {
+			add(hash, transition->type);
+			add(hash, transition->percentage);
+			add(hash, transition->state);
+			add(hash, transition->color.toInteger());
+		}
+		return hash;
+	}
+	inline void RedrawTracker::addComponent(std::uint64_t& hash, Component& component) {
+		if (Menu* menu = dynamic_cast<Menu*>(&component)) {
+			add(hash, menu->components.size());
+			for (Menu::ComponentContainer& container : menu->components)
+				if (container.ptr != nullptr)
+					addComponent(hash, *container.ptr);
+		}
+		else if (Button* button = dynamic_cast<Button*>(&component)) {
+			Text& text = priv::ButtonAccess::getText(*button);
+
+			add(hash, priv::ButtonAccess::getVirtualHitbox(*button));
+			add(hash, priv::ButtonAccess::getCurrentColor(*button).toInteger());
+			add(hash, priv::ButtonAccess::isHidden(*button));
+			add(hash, text.getString());
+			add(hash, text.getPosition());
+			add(hash, text.getScale());
+			add(hash, text.getFillColor().toInteger());
+
+			if (Textbox* textbox = dynamic_cast<Textbox*>(&component)) {
+				add(hash, textbox->getStoredString());
+				add(hash, textbox->getActive());
+
+				// The cursor blinks every cursorTickSpeed frames.
+				if (textbox->getActive() && textbox->getCursorTickSpeed() > 0)
+					add(hash, input::priv::ticks / textbox->getCursorTickSpeed());
+			}
+		}
+		else if (Slider* slider = dynamic_cast<Slider*>(&component)) {
+			add(hash, slider->getHitbox());
+			add(hash, priv::SliderAccess::getRenderPercentage(*slider));
+			addComponent(hash, slider->button);
+		}
+		else if (Text* text = dynamic_cast<Text*>(&component)) {
+			add(hash, text->getString());
+			add(hash, text->getPosition());
+			add(hash, text->getScale());
+			add(hash, text->getFillColor().toInteger());
+			add(hash, text->getOutlineColor().toInteger());
+		}
+		else if (Sprite* sprite = dynamic_cast<Sprite*>(&component)) {
+			const sf::Sprite& internal = sprite->getSprite();
+			add(hash, internal.getPosition());
+			add(hash, internal.getScale());
+			add(hash, internal.getRotation());
+			add(hash, internal.getColor().toInteger());
+			add(hash, internal.getTextureRect());
+			add(hash, internal.getTexture());
+		}
+		else if (RoundedRectangle* rect = dynamic_cast<RoundedRectangle*>(&component)) {
+			add(hash, rect->getHitbox());
+			add(hash, rect->getFillColor().toInteger());
+			add(hash, rect->getOutlineColor().toInteger());
+			add(hash, rect->getOutlineThickness());
+		}
+		else if (LiveGraph* graph = dynamic_cast<LiveGraph*>(&component)) {
+			add(hash, graph->getHitbox());
+			add(hash, graph->getLowerBound());
+			add(hash, graph->getUpperBound());
+			for (size_t i = 0; i < graph->getSeriesCount(); i++)
+				add(hash, graph->getPoints(i).getPushCount());
+		}
+		else
+			add(hash, component.getHitbox());
+	}
+	inline void RedrawTracker::addBytes(std::uint64_t& hash, const void* data, size_t size) {
+		const unsigned char* bytes = static_cast<const unsigned char*>(data);
+		for (size_t i = 0; i < size; i++) {
+			hash ^= bytes[i];
+			hash *= 1099511628211ull;
+		}
+	}
+	template <typename Type>
+	inline void RedrawTracker::add(std::uint64_t& hash, const Type& value) {
+		unsigned char bytes[sizeof(Type)];
+		std::memcpy(bytes, &value, sizeof(Type));
+		addBytes(hash, bytes, sizeof(Type));
+	}
+	inline void RedrawTracker::add(std::uint64_t& hash, const std::string& string) {
+		add(hash, string.size());
+		addBytes(hash, string.data(), string.size());
+	}
+	inline void RedrawTracker::add(std::uint64_t& hash, const Hitbox& hitbox) {
+		add(hash, hitbox.shape);
+		add(hash, hitbox.getPosition());
+		if (hitbox.shape == Hitbox::Shape::Circle)
+			add(hash, hitbox.getRadius());
+		else
+			add(hash, hitbox.getSize());
+	}
+}
\ No newline at end of file
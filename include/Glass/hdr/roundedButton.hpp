@@ -0,0 +1,146 @@
+#pragma once
+
+// Dependencies
+#include <algorithm>
+
+#include "button.hpp"
+#include "buttonAccess.hpp"
+#include "cachedRoundedRectangle.hpp"
+
+namespace gs {
+	///////////////////////////////////////////////////////////
+	/// class RoundedButton is a Basic rectangular Button with
+	/// rounded corners. The corners are drawn with the shared
+	/// corner arcs of priv::getCornerArcs(), so resizing the
+	/// shape every frame during a hover animation doesn't run
+	/// any trig. Textured, circular and hidden RoundedButtons
+	/// render the same as a Button.
+	///////////////////////////////////////////////////////////
+	class RoundedButton : public Button {
+	public:
+		RoundedButton() = default;
+		~RoundedButton() = default;
+
+		///////////////////////////////////////////////////////////
+		/// Method update() will update the Button and match the
+		/// internal shape to it.
+		///////////////////////////////////////////////////////////
+		virtual void update() override;
+		///////////////////////////////////////////////////////////
+		/// Method render() will render the RoundedButton object to
+		/// a sf::RenderTarget.
+		/// @param sf::RenderTarget* target: Pointer to the target
+		///  you want to render. Example: &window.
+		/// @param sf::RenderStates: Used for advanced blending and
+		///  custom shaders. By default it is set to
+		///  sf::RenderStates::Default.
+		///////////////////////////////////////////////////////////
+		virtual void render(
+			sf::RenderTarget* target,
+			sf::RenderStates renderStates = sf::RenderStates::Default
+		) override;
+
+		///////////////////////////////////////////////////////////
+		/// Method setCornerRadius() will set the arc radius of the
+		/// corners. It is limited to half of the smaller side.
+		/// @param float radius: Arc size in pixels.
+		///////////////////////////////////////////////////////////
+		virtual void setCornerRadius(float radius);
+		///////////////////////////////////////////////////////////
+		/// Method setCornerPointCount() will set the number of
+		/// verticies at each corner.
+		/// @param unsigned int count: Number of vertices.
+		///////////////////////////////////////////////////////////
+		virtual void setCornerPointCount(unsigned int count);
+
+		///////////////////////////////////////////////////////////
+		/// @returns float: Radius of corners in pixels.
+		///////////////////////////////////////////////////////////
+		virtual float getCornerRadius() const;
+		///////////////////////////////////////////////////////////
+		/// @returns unsigned int: Number of verticies per corner.
+		///////////////////////////////////////////////////////////
+		virtual unsigned int getCornerPointCount() const;
+		///////////////////////////////////////////////////////////
+		/// @returns bool: True if render() draws the rounded shape
+		///  instead of calling Button::render().
+		///////////////////////////////////////////////////////////
+		virtual bool isRounded() const;
+		///////////////////////////////////////////////////////////
+		/// Method syncShape() will match the internal shape to the
+		/// current size, color and outline of the Button. It is
+		/// called by update() and render(). Only a change of size
+		/// or radius recomputes the points.
+		///////////////////////////////////////////////////////////
+		virtual void syncShape();
+		///////////////////////////////////////////////////////////
+		/// @returns priv::CachedRoundedRectangleShape&: Internal
+		///  shape reference as of the last syncShape().
+		///////////////////////////////////////////////////////////
+		virtual priv::CachedRoundedRectangleShape& getInternalShape();
+	protected:
+		/// Radius of the corners in pixels.
+		float cornerRadius = 8.0f;
+		/// Shape drawn in place of the rectangle.
+		priv::CachedRoundedRectangleShape roundedShape
+			= priv::CachedRoundedRectangleShape(Vec2f(), 8.0f, 8);
+	};
+
+	///////////////////////////////////////////////////////////
+	/// RoundedButton
+	///////////////////////////////////////////////////////////
+
+	inline void RoundedButton::update() {
+		Button::update();
+		syncShape();
+	}
+	inline void RoundedButton::render(
+		sf::RenderTarget* target, sf::RenderStates renderStates
+	) {
+		if (!isRounded()) {
+			Button::render(target, renderStates);
+			return;
+		}
+
+		syncShape();
+		target->draw(roundedShape, renderStates);
+		if (!getString().empty())
+			text.render(target, renderStates);
+	}
+
+	inline void RoundedButton::setCornerRadius(float radius) {
+		cornerRadius = std::max(radius, 0.0f);
+	}
+	inline void RoundedButton::setCornerPointCount(unsigned int count) {
+		roundedShape.setCornerPointCount(std::max(count, 1u));
+	}
+
+	inline float RoundedButton::getCornerRadius() const {
+		return cornerRadius;
+	}
+	inline unsigned int RoundedButton::getCornerPointCount() const {
+		return roundedShape.getCornerPointCount();
+	}
+	inline bool RoundedButton::isRounded() const {
+		return renderMethod == RenderMethod::Basic && shape == Shape::Rectangle
+			&& !priv::ButtonAccess::isHidden(*this);
+	}
+	inline void RoundedButton::syncShape() {
+		const Vec2f size = virtualHitbox.getSize();
+		const float radius = std::min(cornerRadius,
+			std::min(size.x, size.y) / 2.0f);
+
+		// Only a resize reaches sf::Shape::update().
+		if (radius != roundedShape.getCornersRadius())
+			roundedShape.setCornersRadius(radius);
+		if (size != roundedShape.getSize())
+			roundedShape.setSize(size);
+		roundedShape.setPosition(virtualHitbox.getPosition());
+		roundedShape.setFillColor(currentColor);
+		roundedShape.setOutlineThickness(outlineThickness);
+		roundedShape.setOutlineColor(outlineColor);
+	}
+	inline priv::CachedRoundedRectangleShape& RoundedButton::getInternalShape() {
+		return roundedShape;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,415 @@
+#pragma once
+
+// Dependencies
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+#include "cachedRoundedRectangle.hpp"
+#include "buttonAccess.hpp"
+
+namespace gs {
+	namespace priv {
+		/// Vertex shader of SdfShape. Passes local pixel coordinates through.
+		const char* const sdfVertexShader =
+			"void main() {\n"
+			"	gl_Position = gl_ModelViewProjectionMatrix * gl_Vertex;\n"
+			"	gl_TexCoord[0] = gl_MultiTexCoord0;\n"
+			"	gl_FrontColor = gl_Color;\n"
+			"}\n";
+		/// Fragment shader of SdfShape. GLSL 1.10 so it runs on Mesa's
+		/// software renderer.
+		const char* const sdfFragmentShader =
+			"uniform vec2 halfSize;\n"
+			"uniform float radius;\n"
+			"uniform float outlineThickness;\n"
+			"uniform vec4 fillColor;\n"
+			"uniform vec4 outlineColor;\n"
+			"uniform vec4 dropShadowColor;\n"
+			"uniform vec2 dropShadowOffset;\n"
+			"float roundedBox(vec2 p) {\n"
+			"	vec2 q = abs(p) - halfSize + radius;\n"
+			"	return min(max(q.x, q.y), 0.0) + length(max(q, 0.0)) - radius;\n"
+			"}\n"
+			"float coverage(float distance, float width) {\n"
+			"	return clamp(0.5 - distance / width, 0.0, 1.0);\n"
+			"}\n"
+			"vec4 premultiply(vec4 color) {\n"
+			"	return vec4(color.rgb * color.a, color.a);\n"
+			"}\n"
+			"void main() {\n"
+			"	vec2 p = gl_TexCoord[0].xy - halfSize;\n"
+			"	float d = roundedBox(p);\n"
+			"	float width = max(fwidth(d), 0.0001);\n"
+			"	float outer = coverage(d - max(outlineThickness, 0.0), width);\n"
+			"	float inner = coverage(d - min(outlineThickness, 0.0), width);\n"
+			"	vec4 shape = premultiply(fillColor) * inner\n"
+			"		+ premultiply(outlineColor) * (outer - inner);\n"
+			"	float s = roundedBox(p - dropShadowOffset) - max(outlineThickness, 0.0);\n"
+			"	vec4 shadow = premultiply(dropShadowColor) * coverage(s, width);\n"
+			"	vec4 color = shape + shadow * (1.0 - shape.a);\n"
+			"	gl_FragColor = vec4(color.rgb / max(color.a, 0.0001), color.a)\n"
+			"		* gl_Color;\n"
+			"}\n";
+
+		///////////////////////////////////////////////////////////
+		/// Function getSdfShader() will return the shader used by
+		/// SdfShape. It is compiled the first time it is needed
+		/// and shared afterwards. Note: Call this from the thread
+		/// that owns the OpenGL context.
+		/// @returns sf::Shader*: The shader or nullptr if shaders
+		///  aren't available or it failed to compile.
+		///////////////////////////////////////////////////////////
+		inline sf::Shader* getSdfShader() {
+			static std::unique_ptr<sf::Shader> shader;
+			static bool compiled = false;
+
+			if (!compiled) {
+				compiled = true;
+
+				if (sf::Shader::isAvailable()) {
+					shader.reset(new sf::Shader());
+
+					if (!shader->loadFromMemory(sdfVertexShader, sdfFragmentShader)) {
+						GLASS_ERROR("Failed to compile SDF shader", 0);
+						shader.reset();
+					}
+				}
+			}
+			return shader.get();
+		}
+	}
+
+	///////////////////////////////////////////////////////////
+	/// class SdfShape is a rounded rectangle or circle that is
+	/// drawn as a single quad with a signed distance field
+	/// shader. The fill, outline and drop shadow are all
+	/// computed per pixel which gives anti-aliased edges
+	/// without MSAA and a vertex count independent of the
+	/// corner detail. If shaders aren't available it falls back
+	/// to tessellated geometry.
+	///////////////////////////////////////////////////////////
+	class SdfShape : public sf::Drawable, public sf::Transformable {
+	public:
+		SdfShape() = default;
+		~SdfShape() = default;
+
+		///////////////////////////////////////////////////////////
+		/// Method setSize() will change the size of the shape.
+		/// @param Vec2f size: New size in pixels.
+		///////////////////////////////////////////////////////////
+		void setSize(Vec2f size);
+		///////////////////////////////////////////////////////////
+		/// Method setCornerRadius() will set the radius of the
+		/// corners. Note: A radius of half the smallest side makes
+		/// a circle or a pill.
+		/// @param float radius: Radius in pixels.
+		///////////////////////////////////////////////////////////
+		void setCornerRadius(float radius);
+		///////////////////////////////////////////////////////////
+		/// Method setFillColor() will set the inside color.
+		/// @param Color color: Fill color.
+		///////////////////////////////////////////////////////////
+		void setFillColor(Color color);
+		///////////////////////////////////////////////////////////
+		/// Method setOutlineThickness() will set the thickness of
+		/// the outline. Positive values grow outwards like
+		/// sf::Shape.
+		/// @param float thickness: Thickness in pixels.
+		///////////////////////////////////////////////////////////
+		void setOutlineThickness(float thickness);
+		///////////////////////////////////////////////////////////
+		/// Method setOutlineColor() will set the outline color.
+		/// @param Color color: Outline color.
+		///////////////////////////////////////////////////////////
+		void setOutlineColor(Color color);
+		///////////////////////////////////////////////////////////
+		/// Method setDropShadow() will enable or disable a copy of
+		/// the shape drawn behind it. Note: This is a shadow of the
+		/// shape, not the Text shadow of a Style.
+		/// @param bool hasDropShadow: True to enable the shadow.
+		///////////////////////////////////////////////////////////
+		void setDropShadow(bool hasDropShadow);
+		///////////////////////////////////////////////////////////
+		/// Method setDropShadowOffset() will set the offset of the
+		/// drop shadow from the shape.
+		/// @param Vec2f offset: Offset in pixels.
+		///////////////////////////////////////////////////////////
+		void setDropShadowOffset(Vec2f offset);
+		///////////////////////////////////////////////////////////
+		/// Method setDropShadowColor() will set the color of the
+		/// drop shadow.
+		/// @param Color color: Drop shadow color.
+		///////////////////////////////////////////////////////////
+		void setDropShadowColor(Color color);
+
+		///////////////////////////////////////////////////////////
+		/// @returns Vec2f: Size of shape.
+		///////////////////////////////////////////////////////////
+		Vec2f getSize() const;
+		///////////////////////////////////////////////////////////
+		/// @returns float: Radius of corners in pixels.
+		///////////////////////////////////////////////////////////
+		float getCornerRadius() const;
+		///////////////////////////////////////////////////////////
+		/// @returns Color: Fill color.
+		///////////////////////////////////////////////////////////
+		Color getFillColor() const;
+		///////////////////////////////////////////////////////////
+		/// @returns float: Outline thickness in pixels.
+		///////////////////////////////////////////////////////////
+		float getOutlineThickness() const;
+		///////////////////////////////////////////////////////////
+		/// @returns Color: Outline color.
+		///////////////////////////////////////////////////////////
+		Color getOutlineColor() const;
+		///////////////////////////////////////////////////////////
+		/// @returns bool: True if the drop shadow is enabled.
+		///////////////////////////////////////////////////////////
+		bool hasDropShadow() const;
+		///////////////////////////////////////////////////////////
+		/// @returns Vec2f: Drop shadow offset from the shape.
+		///////////////////////////////////////////////////////////
+		Vec2f getDropShadowOffset() const;
+		///////////////////////////////////////////////////////////
+		/// @returns Color: Drop shadow color.
+		///////////////////////////////////////////////////////////
+		Color getDropShadowColor() const;
+
+		///////////////////////////////////////////////////////////
+		/// @returns bool: True if the SDF shader can be used. If
+		///  false SdfShape draws tessellated geometry instead.
+		///////////////////////////////////////////////////////////
+		static bool isAvailable();
+	protected:
+		/// Size of the shape.
+		Vec2f size;
+		/// Radius of the corners.
+		float cornerRadius = 0.0f;
+		/// Fill color.
+		Color fillColor = Color::White;
+		/// Outline thickness.
+		float outlineThickness = 0.0f;
+		/// Outline color.
+		Color outlineColor = Color::Black;
+		/// Drop shadow boolean. Set to false by default.
+		bool dropShadow = false;
+		/// Drop shadow offset from the shape.
+		Vec2f dropShadowOffset = Vec2f(5.0f, 5.0f);
+		/// Color of drop shadow. Translucent by default.
+		Color dropShadowColor = Color(0, 0, 0, 200);
+
+		///////////////////////////////////////////////////////////
+		/// Method draw() is the overriden sf::Drawable method.
+		///////////////////////////////////////////////////////////
+		virtual void draw(
+			sf::RenderTarget& target, sf::RenderStates states) const override;
+	};
+
+	///////////////////////////////////////////////////////////
+	/// Function drawSdf() will render a RoundedRectangle with
+	/// an SdfShape instead of its tessellated shape. The Style
+	/// shadow only applies to Text so no shadow is drawn.
+	/// @param sf::RenderTarget* target: Pointer to the target
+	///  you want to render. Example: &window.
+	/// @param RoundedRectangle& rect: RoundedRectangle object
+	///  reference.
+	/// @param sf::RenderStates: Used for advanced blending and
+	///  custom shaders. By default it is set to
+	///  sf::RenderStates::Default.
+	///////////////////////////////////////////////////////////
+	void drawSdf(
+		sf::RenderTarget* target,
+		RoundedRectangle& rect,
+		sf::RenderStates renderStates = sf::RenderStates::Default
+	);
+	///////////////////////////////////////////////////////////
+	/// Function drawSdf() will render a Button with an
+	/// SdfShape instead of its tessellated shape. The Text is
+	/// rendered with its Style shadow like Button::render().
+	/// Textured or hidden Buttons are rendered normally.
+	/// @param sf::RenderTarget* target: Pointer to the target
+	///  you want to render. Example: &window.
+	/// @param Button& button: Button object reference.
+	/// @param sf::RenderStates: Used for advanced blending and
+	///  custom shaders. By default it is set to
+	///  sf::RenderStates::Default.
+	///////////////////////////////////////////////////////////
+	void drawSdf(
+		sf::RenderTarget* target,
+		Button& button,
+		sf::RenderStates renderStates = sf::RenderStates::Default
+	);
+
+	///////////////////////////////////////////////////////////
+	/// SdfShape
+	///////////////////////////////////////////////////////////
+
+	inline void SdfShape::setSize(Vec2f size) {
+		this->size = size;
+	}
+	inline void SdfShape::setCornerRadius(float radius) {
+		cornerRadius = radius;
+	}
+	inline void SdfShape::setFillColor(Color color) {
+		fillColor = color;
+	}
+	inline void SdfShape::setOutlineThickness(float thickness) {
+		outlineThickness = thickness;
+	}
+	inline void SdfShape::setOutlineColor(Color color) {
+		outlineColor = color;
+	}
+	inline void SdfShape::setDropShadow(bool hasDropShadow) {
+		dropShadow = hasDropShadow;
+	}
+	inline void SdfShape::setDropShadowOffset(Vec2f offset) {
+		dropShadowOffset = offset;
+	}
+	inline void SdfShape::setDropShadowColor(Color color) {
+		dropShadowColor = color;
+	}
+
+	inline Vec2f SdfShape::getSize() const {
+		return size;
+	}
+	inline float SdfShape::getCornerRadius() const {
+		return cornerRadius;
+	}
+	inline Color SdfShape::getFillColor() const {
+		return fillColor;
+	}
+	inline float SdfShape::getOutlineThickness() const {
+		return outlineThickness;
+	}
+	inline Color SdfShape::getOutlineColor() const {
+		return outlineColor;
+	}
+	inline bool SdfShape::hasDropShadow() const {
+		return dropShadow;
+	}
+	inline Vec2f SdfShape::getDropShadowOffset() const {
+		return dropShadowOffset;
+	}
+	inline Color SdfShape::getDropShadowColor() const {
+		return dropShadowColor;
+	}
+
+	inline bool SdfShape::isAvailable() {
+		return priv::getSdfShader() != nullptr;
+	}
+
+	inline void SdfShape::draw(
+		sf::RenderTarget& target, sf::RenderStates states
+	) const {
+		const float radius = std::min(std::max(cornerRadius, 0.0f),
+			std::min(size.x, size.y) / 2.0f);
+
+		states.transform *= getTransform();
+
+		sf::Shader* shader = priv::getSdfShader();
+		if (shader == nullptr || states.shader != nullptr) {
+			// Fallback used when shaders aren't supported.
+			if (dropShadow) {
+				priv::CachedRoundedRectangleShape shape(size, radius, 16);
+				shape.setPosition(dropShadowOffset);
+				shape.setFillColor(dropShadowColor);
+				shape.setOutlineThickness(std::max(outlineThickness, 0.0f));
+				shape.setOutlineColor(dropShadowColor);
+				target.draw(shape, states);
+			}
+			priv::CachedRoundedRectangleShape shape(size, radius, 16);
+			shape.setFillColor(fillColor);
+			shape.setOutlineThickness(outlineThickness);
+			shape.setOutlineColor(outlineColor);
+			target.draw(shape, states);
+			return;
+		}
+
+		// The quad has to cover the outline, the drop shadow and
+		// the anti-aliased edge.
+		const float margin = std::max(outlineThickness, 0.0f) + 2.0f
+			+ (dropShadow ? std::max(std::abs(dropShadowOffset.x),
+				std::abs(dropShadowOffset.y)) : 0.0f);
+		const Vec2f minimum(-margin, -margin);
+		const Vec2f maximum(size.x + margin, size.y + margin);
+		const sf::Vertex quad[4] = {
+			sf::Vertex(minimum, Color::White, minimum),
+			sf::Vertex(Vec2f(maximum.x, minimum.y), Color::White,
+				Vec2f(maximum.x, minimum.y)),
+			sf::Vertex(Vec2f(minimum.x, maximum.y), Color::White,
+				Vec2f(minimum.x, maximum.y)),
+			sf::Vertex(maximum, Color::White, maximum)
+		};
+
+		shader->setUniform("halfSize", sf::Glsl::Vec2(size / 2.0f));
+		shader->setUniform("radius", radius);
+		shader->setUniform("outlineThickness", outlineThickness);
+		shader->setUniform("fillColor", sf::Glsl::Vec4(fillColor));
+		shader->setUniform("outlineColor", sf::Glsl::Vec4(outlineColor));
+		shader->setUniform("dropShadowColor",
+			sf::Glsl::Vec4(dropShadow ? dropShadowColor : Color::Transparent));
+		shader->setUniform("dropShadowOffset", sf::Glsl::Vec2(dropShadowOffset));
+
+		states.shader = shader;
+		states.texture = nullptr;
+		target.draw(quad, 4, sf::TriangleStrip, states);
+	}
+
+	///////////////////////////////////////////////////////////
+	/// drawSdf
+	///////////////////////////////////////////////////////////
+
+	inline void drawSdf(
+		sf::RenderTarget* target, RoundedRectangle& rect,
+		sf::RenderStates renderStates
+	) {
+		const priv::RoundedRectangleShape& internalShape
+			= rect.getInternalShape();
+		SdfShape shape;
+
+		shape.setPosition(internalShape.getPosition());
+		shape.setOrigin(internalShape.getOrigin());
+		shape.setScale(internalShape.getScale());
+		shape.setRotation(internalShape.getRotation());
+		shape.setSize(internalShape.getSize());
+		shape.setCornerRadius(internalShape.getCornersRadius());
+		shape.setFillColor(internalShape.getFillColor());
+		shape.setOutlineThickness(internalShape.getOutlineThickness());
+		shape.setOutlineColor(internalShape.getOutlineColor());
+
+		target->draw(shape, renderStates);
+	}
+	inline void drawSdf(
+		sf::RenderTarget* target, Button& button,
+		sf::RenderStates renderStates
+	) {
+		if (button.renderMethod != Button::RenderMethod::Basic
+			|| priv::ButtonAccess::isHidden(button)) {
+			button.render(target, renderStates);
+			return;
+		}
+
+		const Hitbox& hitbox = priv::ButtonAccess::getVirtualHitbox(button);
+		SdfShape shape;
+
+		if (button.shape == Button::Shape::Circle) {
+			const float radius = hitbox.getRadius();
+			shape.setPosition(hitbox.getCenter() - Vec2f(radius, radius));
+			shape.setSize(Vec2f(radius, radius) * 2.0f);
+			shape.setCornerRadius(radius);
+		}
+		else {
+			shape.setPosition(hitbox.getPosition());
+			shape.setSize(hitbox.getSize());
+		}
+		shape.setFillColor(priv::ButtonAccess::getCurrentColor(button));
+		shape.setOutlineThickness(button.getOutlineThickness());
+		shape.setOutlineColor(button.getOutlineColor());
+
+		target->draw(shape, renderStates);
+
+		if (!button.getString().empty())
+			priv::ButtonAccess::getText(button).render(target, renderStates);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,332 @@
+#pragma once
+
+// Dependencies
+#include <cmath>
+#include <memory>
+
+#include "transition.hpp"
+#include "util/profiler.hpp"
+
+namespace gs {
+	///////////////////////////////////////////////////////////
+	/// class ShaderTransition is a Transition drawn by a
+	/// fragment shader in a single full-screen pass. Besides
+	/// fade and scope it can wipe, dissolve and blur. Effects
+	/// that read the scene, such as Blur, need the scene to be
+	/// drawn to the RenderTarget returned by begin(). It is a
+	/// RenderTexture shared by every ShaderTransition and only
+	/// recreated when the window size changes. Example:
+	///
+	/// sf::RenderTarget& scene = transition.begin(window);
+	/// menu.render(&scene);
+	/// transition.apply(window);
+	///
+	/// Without begin() the effect is drawn over the target as
+	/// an overlay. If shaders aren't available Transition is
+	/// drawn instead. The values mean the same as in Transition:
+	/// percentage is the alpha of the color from 0 to 255, or
+	/// for Scope the scope closes to a radius of
+	/// max - percentage + 1 around the position. Nothing is
+	/// drawn while state is 0. The effect follows type, so
+	/// Type::Scope draws Effect::Scope and Type::Fade draws
+	/// any of the other effects.
+	///////////////////////////////////////////////////////////
+	class ShaderTransition : public Transition {
+	public:
+		/// The effect drawn by the shader. By default it is Fade.
+		enum class Effect { Fade, Scope, Wipe, Dissolve, Blur };
+
+		ShaderTransition() = default;
+		~ShaderTransition() = default;
+
+		///////////////////////////////////////////////////////////
+		/// Method begin() will return the RenderTarget the scene
+		/// should be drawn to this frame. It is cleared and uses
+		/// the view of the target. apply() then draws it to the
+		/// target with the effect.
+		/// @param sf::RenderTarget& target: Target apply() will be
+		///  called with.
+		/// @returns sf::RenderTarget&: The shared RenderTexture, or
+		///  the target itself if it couldn't be created.
+		///////////////////////////////////////////////////////////
+		virtual sf::RenderTarget& begin(sf::RenderTarget& target);
+		///////////////////////////////////////////////////////////
+		/// Method apply() will render the transition to a target
+		/// with one draw call.
+		/// @param sf::RenderTarget& target: Target to render at.
+		///////////////////////////////////////////////////////////
+		virtual void apply(sf::RenderTarget& target) override;
+		///////////////////////////////////////////////////////////
+		/// Method setType() will change the Type of the Transition
+		/// and initialize the values like Transition::setType().
+		/// The effect is changed to Effect::Scope for Type::Scope
+		/// and to Effect::Fade for Type::Fade.
+		/// @param Type type: Type of Transition style.
+		///////////////////////////////////////////////////////////
+		virtual void setType(Type type) override;
+		///////////////////////////////////////////////////////////
+		/// Method setEffect() will change the effect of the
+		/// Transition. If it needs a different Type, such as
+		/// Effect::Scope, setType() is called as well.
+		/// @param Effect effect: New effect.
+		///////////////////////////////////////////////////////////
+		virtual void setEffect(Effect effect);
+		///////////////////////////////////////////////////////////
+		/// Method setBlurRadius() will change how far the scene is
+		/// blurred at the end of a Blur transition.
+		/// @param float radius: Radius in pixels.
+		///////////////////////////////////////////////////////////
+		virtual void setBlurRadius(float radius);
+
+		///////////////////////////////////////////////////////////
+		/// @returns Effect: Effect drawn by apply(). Type::Scope
+		///  always draws Effect::Scope.
+		///////////////////////////////////////////////////////////
+		virtual Effect getEffect() const;
+		///////////////////////////////////////////////////////////
+		/// @returns float: Blur radius in pixels.
+		///////////////////////////////////////////////////////////
+		virtual float getBlurRadius() const;
+		///////////////////////////////////////////////////////////
+		/// @returns float: Progress of the Transition from 0 to 1.
+		///  It is percentage used as an alpha from 0 to 255.
+		///////////////////////////////////////////////////////////
+		virtual float getProgress() const;
+		///////////////////////////////////////////////////////////
+		/// @returns float: Radius of the Scope around the position
+		///  which is max - percentage + 1.
+		///////////////////////////////////////////////////////////
+		virtual float getScopeRadius() const;
+
+		///////////////////////////////////////////////////////////
+		/// @returns bool: True if shaders are available and the
+		///  transition shader compiled.
+		///////////////////////////////////////////////////////////
+		static bool isAvailable();
+	protected:
+		/// Effect drawn by the shader.
+		Effect effect = Effect::Fade;
+		/// Blur radius in pixels at the end of the Transition.
+		float blurRadius = 12.0f;
+		/// Scene drawn since begin() or nullptr.
+		sf::RenderTexture* canvas = nullptr;
+	};
+
+	///////////////////////////////////////////////////////////
+	/// ShaderTransition
+	///////////////////////////////////////////////////////////
+
+	namespace priv {
+		/// Fragment shader of ShaderTransition. GLSL 1.10 so it runs on
+		/// Mesa's software renderer. Pixel coordinates are taken from
+		/// gl_FragCoord so they don't depend on the texture flip.
+		const char* const transitionFragmentShader =
+			"uniform sampler2D scene;\n"
+			"uniform bool hasScene;\n"
+			"uniform int effect;\n"
+			"uniform float progress;\n"
+			"uniform vec4 color;\n"
+			"uniform vec2 resolution;\n"
+			"uniform vec2 center;\n"
+			"uniform float radius;\n"
+			"uniform float blurRadius;\n"
+			"float hash(vec2 p) {\n"
+			"	return fract(sin(dot(p, vec2(12.9898, 78.233))) * 43758.5453);\n"
+			"}\n"
+			"vec4 blur(vec2 uv, float radius) {\n"
+			"	vec2 offset = radius / (2.0 * resolution);\n"
+			"	vec4 sum = vec4(0.0);\n"
+			"	for (int x = -2; x <= 2; x++)\n"
+			"		for (int y = -2; y <= 2; y++)\n"
+			"			sum += texture2D(scene, uv + vec2(float(x), float(y)) * offset);\n"
+			"	return sum / 25.0;\n"
+			"}\n"
+			"void main() {\n"
+			"	vec2 uv = gl_TexCoord[0].xy;\n"
+			"	vec2 pixel = vec2(gl_FragCoord.x, resolution.y - gl_FragCoord.y);\n"
+			"	vec4 base = hasScene ? texture2D(scene, uv) : vec4(0.0);\n"
+			"	float mask = progress;\n"
+			"	if (effect == 1)\n"
+			"		mask = clamp(distance(pixel, center) - radius + 0.5, 0.0, 1.0);\n"
+			"	else if (effect == 2)\n"
+			"		mask = clamp(progress * resolution.x - pixel.x + 0.5, 0.0, 1.0);\n"
+			"	else if (effect == 3)\n"
+			"		mask = step(hash(floor(pixel)), progress);\n"
+			"	else if (effect == 4) {\n"
+			"		if (hasScene)\n"
+			"			base = blur(uv, blurRadius * progress);\n"
+			"		mask = progress * progress;\n"
+			"	}\n"
+			"	mask *= color.a;\n"
+			"	if (hasScene)\n"
+			"		gl_FragColor = vec4(mix(base.rgb, color.rgb, mask), 1.0);\n"
+			"	else\n"
+			"		gl_FragColor = vec4(color.rgb, mask);\n"
+			"}\n";
+
+		///////////////////////////////////////////////////////////
+		/// Function getTransitionShader() will return the shader
+		/// used by ShaderTransition. It is compiled the first time
+		/// it is needed and shared afterwards. Note: Call this from
+		/// the thread that owns the OpenGL context.
+		/// @returns sf::Shader*: The shader or nullptr if shaders
+		///  aren't available or it failed to compile.
+		///////////////////////////////////////////////////////////
+		inline sf::Shader* getTransitionShader() {
+			static std::unique_ptr<sf::Shader> shader;
+			static bool compiled = false;
+
+			if (!compiled) {
+				compiled = true;
+
+				if (sf::Shader::isAvailable()) {
+					shader.reset(new sf::Shader());
+
+					if (!shader->loadFromMemory(transitionFragmentShader, sf::Shader::Fragment)) {
+						GLASS_ERROR("Failed to compile transition shader", 0);
+						shader.reset();
+					}
+				}
+			}
+			return shader.get();
+		}
+		///////////////////////////////////////////////////////////
+		/// Function getTransitionCanvas() will return the
+		/// RenderTexture shared by every ShaderTransition. It is
+		/// only recreated when the size changes.
+		/// @param Vec2u size: Size in pixels.
+		/// @returns sf::RenderTexture*: The RenderTexture or
+		///  nullptr if it couldn't be created.
+		///////////////////////////////////////////////////////////
+		inline sf::RenderTexture* getTransitionCanvas(Vec2u size) {
+			static std::unique_ptr<sf::RenderTexture> canvas;
+			static Vec2u canvasSize;
+
+			if (size.x == 0 || size.y == 0)
+				return nullptr;
+			if (canvas != nullptr && canvasSize == size)
+				return canvas.get();
+
+			canvas.reset(new sf::RenderTexture());
+			if (!canvas->create(size.x, size.y)) {
+				GLASS_ERROR("Failed to create transition canvas", 0);
+				canvas.reset();
+				canvasSize = Vec2u();
+				return nullptr;
+			}
+			canvas->setSmooth(true);
+			canvasSize = size;
+			return canvas.get();
+		}
+	}
+
+	inline sf::RenderTarget& ShaderTransition::begin(sf::RenderTarget& target) {
+		canvas = priv::getTransitionShader() != nullptr
+			? priv::getTransitionCanvas(target.getSize()) : nullptr;
+		if (canvas == nullptr)
+			return target;
+
+		canvas->setView(target.getView());
+		canvas->clear(Color::Black);
+		return *canvas;
+	}
+	inline void ShaderTransition::apply(sf::RenderTarget& target) {
+		GLASS_PROFILE_ZONE("ShaderTransition::apply");
+
+		sf::RenderTexture* scene = canvas;
+		canvas = nullptr;
+
+		sf::Shader* shader = priv::getTransitionShader();
+		if (shader == nullptr) {
+			Transition::apply(target);
+			return;
+		}
+
+		// Transition draws nothing while the state is neutral.
+		if (scene == nullptr && state == 0)
+			return;
+
+		const Effect drawnEffect = getEffect();
+		const float progress = state == 0 ? 0.0f : getProgress();
+
+		// Fade takes its alpha from percentage and Scope from the color.
+		Color drawnColor = color;
+		if (drawnEffect != Effect::Scope)
+			drawnColor.a = 255;
+		if (state == 0)
+			drawnColor.a = 0;
+
+		const Vec2f size(target.getSize());
+		const Vec2f center(target.mapCoordsToPixel(position));
+		const Vec2f edge(target.mapCoordsToPixel(
+			position + Vec2f(getScopeRadius(), 0.0f)));
+		const float radius = std::hypot(edge.x - center.x, edge.y - center.y);
+		if (scene != nullptr)
+			scene->display();
+
+		// Texture coordinates are in pixels since SFML normalizes
+		// them for the bound texture.
+		const sf::Vertex quad[4] = {
+			sf::Vertex(Vec2f(0.0f, 0.0f), Color::White, Vec2f(0.0f, 0.0f)),
+			sf::Vertex(Vec2f(size.x, 0.0f), Color::White, Vec2f(size.x, 0.0f)),
+			sf::Vertex(Vec2f(0.0f, size.y), Color::White, Vec2f(0.0f, size.y)),
+			sf::Vertex(size, Color::White, size)
+		};
+
+		shader->setUniform("scene", sf::Shader::CurrentTexture);
+		shader->setUniform("hasScene", scene != nullptr);
+		shader->setUniform("effect", static_cast<int>(drawnEffect));
+		shader->setUniform("progress", progress);
+		shader->setUniform("color", sf::Glsl::Vec4(drawnColor));
+		shader->setUniform("resolution", sf::Glsl::Vec2(size));
+		shader->setUniform("center", sf::Glsl::Vec2(center));
+		shader->setUniform("radius", radius);
+		shader->setUniform("blurRadius", blurRadius);
+
+		sf::RenderStates states;
+		states.shader = shader;
+		if (scene != nullptr) {
+			states.texture = &scene->getTexture();
+			states.blendMode = sf::BlendNone;
+		}
+
+		const sf::View view = target.getView();
+		target.setView(target.getDefaultView());
+		target.draw(quad, 4, sf::TriangleStrip, states);
+		target.setView(view);
+	}
+	inline void ShaderTransition::setType(Type type) {
+		Transition::setType(type);
+		effect = type == Type::Scope ? Effect::Scope : Effect::Fade;
+	}
+	inline void ShaderTransition::setEffect(Effect effect) {
+		const Type effectType = effect == Effect::Scope ? Type::Scope : Type::Fade;
+		if (effectType != type)
+			Transition::setType(effectType);
+		this->effect = effect;
+	}
+	inline void ShaderTransition::setBlurRadius(float radius) {
+		blurRadius = radius;
+	}
+
+	inline ShaderTransition::Effect ShaderTransition::getEffect() const {
+		if (type == Type::Scope)
+			return Effect::Scope;
+		return effect == Effect::Scope ? Effect::Fade : effect;
+	}
+	inline float ShaderTransition::getBlurRadius() const {
+		return blurRadius;
+	}
+	inline float ShaderTransition::getProgress() const {
+		const float progress = percentage / 255.0f;
+		return progress < 0.0f ? 0.0f : progress > 1.0f ? 1.0f : progress;
+	}
+	inline float ShaderTransition::getScopeRadius() const {
+		const float radius = max - percentage + 1.0f;
+		return radius < 0.0f ? 0.0f : radius;
+	}
+
+	inline bool ShaderTransition::isAvailable() {
+		return priv::getTransitionShader() != nullptr;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,18 @@
+#pragma once
+
+// Dependencies
+#include "slider.hpp"
+
+namespace gs {
+	namespace priv {
+		///////////////////////////////////////////////////////////
+		/// struct SliderAccess is used to read the protected render
+		/// state of a Slider. It is never constructed.
+		///////////////////////////////////////////////////////////
+		struct SliderAccess : public Slider {
+			static float getRenderPercentage(const Slider& slider) {
+				return slider.*(&SliderAccess::renderPercentage);
+			}
+		};
+	}
+}
\ No newline at end of file
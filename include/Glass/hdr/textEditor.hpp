@@ -0,0 +1,438 @@
+#pragma once
+
+// Dependencies
+#include <cmath>
+
+#include "textbox.hpp"
+#include "input/eventQueue.hpp"
+#include "util/profiler.hpp"
+#include "util/textDocument.hpp"
+
+namespace gs {
+	///////////////////////////////////////////////////////////
+	/// class TextEditor is a multi-line Textbox for large text
+	/// such as scripts and chat logs. The text is stored in a
+	/// util::TextDocument so typing at the cursor is amortized
+	/// O(1) and there is no maximum input length. Only the lines
+	/// that fit in the TextEditor are laid out, so scrolling and
+	/// typing cost the same at any document size. Input is read
+	/// from input::getEventQueue() so use input::beginFrame()
+	/// and input::pushEvent() or an InputContext. The arrow,
+	/// Home, End, Page Up, Page Down and Delete keys move the
+	/// cursor and edit the text.
+	///////////////////////////////////////////////////////////
+	class TextEditor : public Textbox {
+	public:
+		TextEditor();
+		~TextEditor() = default;
+
+		///////////////////////////////////////////////////////////
+		/// Method update() will update the TextEditor and apply
+		/// all of the text and key events of this frame in order.
+		///////////////////////////////////////////////////////////
+		virtual void update() override;
+		///////////////////////////////////////////////////////////
+		/// Method render() will render the TextEditor object to a
+		/// sf::RenderTarget.
+		/// @param sf::RenderTarget* target: Pointer to the target
+		///  you want to render. Example: &window.
+		/// @param sf::RenderStates: Used for advanced blending and
+		///  custom shaders. By default it is set to
+		///  sf::RenderStates::Default.
+		///////////////////////////////////////////////////////////
+		virtual void render(
+			sf::RenderTarget* target,
+			sf::RenderStates renderStates = sf::RenderStates::Default
+		) override;
+
+		///////////////////////////////////////////////////////////
+		/// Method setStoredString() will replace all of the text and
+		/// put the cursor at the end.
+		/// @param const std::string& string: New text.
+		///////////////////////////////////////////////////////////
+		virtual void setStoredString(const std::string& string) override;
+		///////////////////////////////////////////////////////////
+		/// Method insert() will type a string at the cursor, such
+		/// as a paste from the clipboard.
+		/// @param const std::string& string: String to add.
+		///////////////////////////////////////////////////////////
+		virtual void insert(const std::string& string);
+		///////////////////////////////////////////////////////////
+		/// Method setCursor() will move the cursor and scroll to
+		/// it.
+		/// @param size_t position: Character index.
+		///////////////////////////////////////////////////////////
+		virtual void setCursor(size_t position);
+		///////////////////////////////////////////////////////////
+		/// Method scroll() will move the view by a number of lines.
+		/// @param long long lines: Lines to scroll. Positive
+		///  scrolls down.
+		///////////////////////////////////////////////////////////
+		virtual void scroll(long long lines);
+		///////////////////////////////////////////////////////////
+		/// Method setFirstLine() will set the line at the top of
+		/// the TextEditor.
+		/// @param size_t line: Line index. It is clamped.
+		///////////////////////////////////////////////////////////
+		virtual void setFirstLine(size_t line);
+		///////////////////////////////////////////////////////////
+		/// Method setPadding() will set the space between the
+		/// edges and the text. By default it is 4.
+		/// @param float padding: Padding in pixels.
+		///////////////////////////////////////////////////////////
+		virtual void setPadding(float padding);
+
+		///////////////////////////////////////////////////////////
+		/// @returns const std::string&: Copy of the document text.
+		///  It is only copied again after the text changed, use
+		///  getDocument() to read single lines of large text.
+		///////////////////////////////////////////////////////////
+		virtual const std::string& getStoredString() const override;
+		///////////////////////////////////////////////////////////
+		/// @returns const util::TextDocument&: Text and cursor.
+		///////////////////////////////////////////////////////////
+		virtual const util::TextDocument& getDocument() const;
+		///////////////////////////////////////////////////////////
+		/// @returns size_t: Line at the top of the TextEditor.
+		///////////////////////////////////////////////////////////
+		virtual size_t getFirstLine() const;
+		///////////////////////////////////////////////////////////
+		/// @returns size_t: Number of lines that fit.
+		///////////////////////////////////////////////////////////
+		virtual size_t getVisibleLineCount() const;
+		///////////////////////////////////////////////////////////
+		/// @returns float: Height of a line in pixels.
+		///////////////////////////////////////////////////////////
+		virtual float getLineHeight() const;
+		///////////////////////////////////////////////////////////
+		/// @returns float: Space between the edges and the text.
+		///////////////////////////////////////////////////////////
+		virtual float getPadding() const;
+	protected:
+		/// Most characters laid out of a single line.
+		static const size_t maxColumns = 512;
+
+		/// Text and cursor.
+		util::TextDocument document;
+		/// Laid out visible lines. Row 0 is firstLine.
+		vector<sf::Text> rows;
+		/// Reused copy of a line.
+		std::string lineString;
+		/// Copy of the document text for getStoredString().
+		mutable std::string documentString;
+		/// True if documentString has to be copied again.
+		mutable bool documentChanged = true;
+		/// Line at the top of the TextEditor.
+		size_t firstLine = 0;
+		/// Space between the edges and the text.
+		float padding = 4.0f;
+		/// Frames since the cursor last moved, for blinking.
+		int cursorTicks = 0;
+		/// True if the visible lines have to be laid out again.
+		bool layoutChanged = true;
+
+		///////////////////////////////////////////////////////////
+		/// Method applyEvent() will apply one event of the queue.
+		/// @param const input::InputEvent& event: Event to apply.
+		/// @returns bool: True if the text or cursor changed.
+		///////////////////////////////////////////////////////////
+		virtual bool applyEvent(const input::InputEvent& event);
+		///////////////////////////////////////////////////////////
+		/// Method moveLines() will move the cursor up or down and
+		/// keep its column if the line is long enough.
+		/// @param long long lines: Lines to move. Positive is down.
+		///////////////////////////////////////////////////////////
+		virtual void moveLines(long long lines);
+		///////////////////////////////////////////////////////////
+		/// Method placeCursor() will move the cursor to the
+		/// character closest to a point.
+		/// @param Vec2f point: Point in the TextEditor.
+		///////////////////////////////////////////////////////////
+		virtual void placeCursor(Vec2f point);
+		///////////////////////////////////////////////////////////
+		/// Method scrollToCursor() will scroll so the cursor line
+		/// is visible.
+		///////////////////////////////////////////////////////////
+		virtual void scrollToCursor();
+		///////////////////////////////////////////////////////////
+		/// Method layout() will lay out the visible lines if they
+		/// changed and position them.
+		///////////////////////////////////////////////////////////
+		virtual void layout();
+	};
+
+	///////////////////////////////////////////////////////////
+	/// TextEditor
+	///////////////////////////////////////////////////////////
+
+	inline TextEditor::TextEditor() {
+		textRenderMethod = TextRenderMethod::None;
+	}
+
+	inline void TextEditor::update() {
+		GLASS_PROFILE_ZONE("TextEditor::update");
+
+		// Hide the last character from Textbox::update() so the
+		// single line string isn't edited too, and Enter so it
+		// types a newline instead of ending typing. -1 is no input.
+		const int textUnicode = input::textUnicode;
+		const bool space = input::priv::space, backSpace = input::priv::backSpace,
+			enter = input::priv::enter;
+		input::textUnicode = -1;
+		input::priv::space = false;
+		input::priv::backSpace = false;
+		input::priv::enter = false;
+
+		Textbox::update();
+
+		input::textUnicode = textUnicode;
+		input::priv::space = space;
+		input::priv::backSpace = backSpace;
+		input::priv::enter = enter;
+
+		cursorTicks++;
+		if (!isActive || inputMethod != InputMethod::Keyboard)
+			return;
+
+		// Textbox::update() shows the single line string with its
+		// own cursor while active. The lines and cursor are drawn by
+		// render() instead.
+		if (!getString().empty())
+			setString("");
+
+		bool changed = false;
+		if (input::mouseClickL && hitbox.intersects(input::mousePosition)) {
+			layout();
+			placeCursor(input::mousePosition);
+			changed = true;
+		}
+		for (const input::InputEvent& event : input::getEventQueue())
+			changed |= applyEvent(event);
+
+		if (changed) {
+			scrollToCursor();
+			cursorTicks = 0;
+			layoutChanged = true;
+			documentChanged = true;
+		}
+	}
+	inline void TextEditor::render(sf::RenderTarget* target, sf::RenderStates renderStates) {
+		GLASS_PROFILE_ZONE("TextEditor::render");
+
+		Textbox::render(target, renderStates);
+		layout();
+
+		for (size_t row = 0; row < rows.size(); row++)
+			if (firstLine + row < document.getLineCount())
+				target->draw(rows[row], renderStates);
+
+		const size_t cursor = document.getCursor();
+		const size_t line = document.getLineOf(cursor);
+		const size_t column = cursor - document.getLineStart(line);
+		const bool blink = cursorTickSpeed > 0 && (cursorTicks / cursorTickSpeed) % 2 == 1;
+
+		if (!isActive || blink || line < firstLine || line - firstLine >= rows.size()
+			|| column > maxColumns)
+			return;
+
+		const sf::Text& row = rows[line - firstLine];
+		sf::RectangleShape cursorShape(Vec2f(2.0f, getLineHeight()));
+		cursorShape.setPosition(row.findCharacterPos(column).x, row.getPosition().y);
+		cursorShape.setFillColor(currentTextColor);
+		target->draw(cursorShape, renderStates);
+	}
+
+	inline void TextEditor::setStoredString(const std::string& string) {
+		document.setString(string);
+		layoutChanged = true;
+		documentChanged = true;
+		scrollToCursor();
+	}
+	inline void TextEditor::insert(const std::string& string) {
+		document.insert(string);
+		layoutChanged = true;
+		documentChanged = true;
+		scrollToCursor();
+	}
+	inline void TextEditor::setCursor(size_t position) {
+		document.setCursor(position);
+		layoutChanged = true;
+		scrollToCursor();
+	}
+	inline void TextEditor::scroll(long long lines) {
+		const long long line = static_cast<long long>(firstLine) + lines;
+		setFirstLine(line < 0 ? 0 : static_cast<size_t>(line));
+	}
+	inline void TextEditor::setFirstLine(size_t line) {
+		line = std::min(line, document.getLineCount() - 1);
+		if (line != firstLine) {
+			firstLine = line;
+			layoutChanged = true;
+		}
+	}
+	inline void TextEditor::setPadding(float padding) {
+		this->padding = padding;
+		layoutChanged = true;
+	}
+
+	inline const std::string& TextEditor::getStoredString() const {
+		if (documentChanged) {
+			documentString = document.getString();
+			documentChanged = false;
+		}
+		return documentString;
+	}
+	inline const util::TextDocument& TextEditor::getDocument() const {
+		return document;
+	}
+	inline size_t TextEditor::getFirstLine() const {
+		return firstLine;
+	}
+	inline size_t TextEditor::getVisibleLineCount() const {
+		const float height = getSize().y - padding * 2.0f;
+		if (height <= 0.0f)
+			return 0;
+		return static_cast<size_t>(std::ceil(height / getLineHeight()));
+	}
+	inline float TextEditor::getLineHeight() const {
+		// Text::getText() has no const overload.
+		const sf::Text& base = const_cast<Text&>(text).getText();
+		const float lineHeight = base.getFont() != nullptr
+			? base.getFont()->getLineSpacing(base.getCharacterSize())
+			: base.getCharacterSize() * 1.2f;
+		return lineHeight > 0.0f ? lineHeight : 1.0f;
+	}
+	inline float TextEditor::getPadding() const {
+		return padding;
+	}
+
+	inline bool TextEditor::applyEvent(const input::InputEvent& event) {
+		if (event.type == input::InputEvent::Type::Text) {
+			const std::uint32_t unicode = event.code;
+
+			// Backspace, enter and tab.
+			if (unicode == 8)
+				document.eraseBefore();
+			else if (unicode == 13 || unicode == '\n')
+				document.insert('\n');
+			else if (unicode == '\t' || (unicode >= 32 && unicode <= 126))
+				document.insert(static_cast<char>(unicode));
+			else
+				return false;
+			return true;
+		}
+
+		if (event.type != input::InputEvent::Type::KeyPressed)
+			return false;
+
+		const size_t cursor = document.getCursor();
+		const size_t line = document.getLineOf(cursor);
+
+		switch (static_cast<sf::Keyboard::Key>(event.code)) {
+		case sf::Keyboard::Left:
+			document.setCursor(cursor > 0 ? cursor - 1 : 0);
+			return true;
+		case sf::Keyboard::Right:
+			document.setCursor(cursor + 1);
+			return true;
+		case sf::Keyboard::Up:
+			moveLines(-1);
+			return true;
+		case sf::Keyboard::Down:
+			moveLines(1);
+			return true;
+		case sf::Keyboard::PageUp:
+			moveLines(-static_cast<long long>(std::max<size_t>(getVisibleLineCount(), 1)));
+			return true;
+		case sf::Keyboard::PageDown:
+			moveLines(static_cast<long long>(std::max<size_t>(getVisibleLineCount(), 1)));
+			return true;
+		case sf::Keyboard::Home:
+			document.setCursor(event.control ? 0 : document.getLineStart(line));
+			return true;
+		case sf::Keyboard::End:
+			document.setCursor(event.control ? document.size() : document.getLineEnd(line));
+			return true;
+		case sf::Keyboard::Delete:
+			document.eraseAfter();
+			return true;
+		default:
+			return false;
+		}
+	}
+	inline void TextEditor::moveLines(long long lines) {
+		const size_t cursor = document.getCursor();
+		const size_t line = document.getLineOf(cursor);
+		const size_t column = cursor - document.getLineStart(line);
+
+		const long long target = std::max(0ll, std::min(static_cast<long long>(line) + lines,
+			static_cast<long long>(document.getLineCount()) - 1));
+		const size_t start = document.getLineStart(static_cast<size_t>(target));
+		const size_t end = document.getLineEnd(static_cast<size_t>(target));
+		document.setCursor(std::min(start + column, end));
+	}
+	inline void TextEditor::placeCursor(Vec2f point) {
+		if (rows.empty())
+			return;
+
+		const float top = getPosition().y + padding;
+		const float offset = std::max(0.0f, (point.y - top) / getLineHeight());
+		const size_t row = std::min(static_cast<size_t>(offset), rows.size() - 1);
+		const size_t line = std::min(firstLine + row, document.getLineCount() - 1);
+		const size_t start = document.getLineStart(line);
+		const size_t length = std::min(document.getLineEnd(line) - start, maxColumns);
+
+		size_t column = 0;
+		while (column < length) {
+			const float left = rows[line - firstLine].findCharacterPos(column).x;
+			const float right = rows[line - firstLine].findCharacterPos(column + 1).x;
+			if (point.x < (left + right) * 0.5f)
+				break;
+			column++;
+		}
+		document.setCursor(start + column);
+	}
+	inline void TextEditor::scrollToCursor() {
+		const size_t line = document.getLineOf(document.getCursor());
+		const size_t visible = std::max<size_t>(getVisibleLineCount(), 1);
+
+		if (line < firstLine)
+			setFirstLine(line);
+		else if (line >= firstLine + visible)
+			setFirstLine(line - visible + 1);
+		else
+			setFirstLine(firstLine);
+	}
+	inline void TextEditor::layout() {
+		const size_t visible = getVisibleLineCount();
+		if (rows.size() != visible) {
+			rows.resize(visible);
+			layoutChanged = true;
+		}
+
+		const sf::Text& base = text.getText();
+		const Vec2f origin = getPosition() + Vec2f(padding, padding);
+		const float lineHeight = getLineHeight();
+
+		for (size_t row = 0; row < rows.size(); row++) {
+			sf::Text& rowText = rows[row];
+
+			if (layoutChanged) {
+				const size_t line = firstLine + row;
+				if (line < document.getLineCount())
+					document.getLine(line, lineString, maxColumns);
+				else
+					lineString.clear();
+
+				if (base.getFont() != nullptr)
+					rowText.setFont(*base.getFont());
+				rowText.setCharacterSize(base.getCharacterSize());
+				rowText.setString(lineString);
+			}
+
+			rowText.setFillColor(currentTextColor);
+			rowText.setPosition(origin.x, origin.y + lineHeight * row);
+		}
+		layoutChanged = false;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,489 @@
+#pragma once
+
+// Dependencies
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "button.hpp"
+#include "util/easing.hpp"
+#include "util/profiler.hpp"
+
+namespace gs {
+	///////////////////////////////////////////////////////////
+	/// class Timeline plays keyframed values over time. Each
+	/// track animates one value, such as the position of a
+	/// Component, the size or scale modifiers of a Button, a
+	/// color of a Style or any float, Vec2f or Color, through
+	/// keyframes joined by easing curves. Curves are evaluated
+	/// from util::EasingTable. Tracks of the same type are kept
+	/// in a dense array and update() evaluates all of them in a
+	/// single pass, so one Timeline can animate hundreds of
+	/// Menu items. Outputs are only written when they change.
+	/// Times are in milliseconds. Example:
+	///
+	/// gs::Timeline timeline;
+	/// gs::Timeline::Track slide = timeline.addPosition(button);
+	/// timeline.addKey(slide, 0.0f, gs::Vec2f(-200.0f, 100.0f));
+	/// timeline.addKey(slide, 400.0f, gs::Vec2f(50.0f, 100.0f),
+	/// 	gs::util::Easing::BackOut);
+	/// timeline.play();
+	///
+	/// timeline.update(1000.0f / 60.0f);
+	///////////////////////////////////////////////////////////
+	class Timeline {
+	public:
+		///////////////////////////////////////////////////////////
+		/// struct Track is a handle to a track of a Timeline.
+		///////////////////////////////////////////////////////////
+		struct Track {
+			/// Type of value the track animates.
+			enum class Kind : std::uint8_t { Float, Vector, Color } kind;
+			/// Index of the track among tracks of its kind.
+			size_t index;
+		};
+
+		Timeline() = default;
+		~Timeline() = default;
+
+		///////////////////////////////////////////////////////////
+		/// Method addFloat() will add a track writing to a float.
+		/// @param float* value: Value to animate. It must outlive
+		///  the track.
+		/// @returns Track: Handle of the track.
+		///////////////////////////////////////////////////////////
+		Track addFloat(float* value);
+		///////////////////////////////////////////////////////////
+		/// Method addVector() will add a track writing to a Vec2f.
+		/// @param Vec2f* value: Value to animate.
+		/// @returns Track: Handle of the track.
+		///////////////////////////////////////////////////////////
+		Track addVector(Vec2f* value);
+		///////////////////////////////////////////////////////////
+		/// Method addColor() will add a track writing to a Color.
+		/// @param Color* value: Value to animate.
+		/// @returns Track: Handle of the track.
+		///////////////////////////////////////////////////////////
+		Track addColor(Color* value);
+		///////////////////////////////////////////////////////////
+		/// Method addPosition() will add a track calling
+		/// setPosition() on a Component.
+		/// @param Component& component: Component to move.
+		/// @returns Track: Vec2f track.
+		///////////////////////////////////////////////////////////
+		Track addPosition(Component& component);
+		///////////////////////////////////////////////////////////
+		/// Method addSize() will add a track calling setSize() on a
+		/// Button.
+		/// @param Button& button: Button to resize.
+		/// @returns Track: Vec2f track.
+		///////////////////////////////////////////////////////////
+		Track addSize(Button& button);
+		///////////////////////////////////////////////////////////
+		/// Method addScaleModifiers() will add a track calling
+		/// setScaleModifiers() on a Button.
+		/// @param Button& button: Button to scale.
+		/// @returns Track: Float track.
+		///////////////////////////////////////////////////////////
+		Track addScaleModifiers(Button& button);
+		///////////////////////////////////////////////////////////
+		/// Method addStyleColor() will add a track setting a color
+		/// of a Style and applying the Style to a Component.
+		/// Example: addStyleColor(button, style,
+		/// &gs::Style::selectedFillColor).
+		/// @param Component& component: Component to restyle.
+		/// @param Style& style: Style to modify. It must outlive
+		///  the track.
+		/// @param Color Style::* color: Color of the Style.
+		/// @returns Track: Color track.
+		///////////////////////////////////////////////////////////
+		Track addStyleColor(Component& component, Style& style, Color Style::* color);
+
+		///////////////////////////////////////////////////////////
+		/// Method addKey() will add a keyframe to a float track.
+		/// @param Track track: Track of the keyframe.
+		/// @param float time: Time of the keyframe.
+		/// @param float value: Value at the time.
+		/// @param util::Easing easing: Curve from the previous
+		///  keyframe to this one. By default it is Linear.
+		///////////////////////////////////////////////////////////
+		void addKey(Track track, float time, float value,
+			util::Easing easing = util::Easing::Linear);
+		///////////////////////////////////////////////////////////
+		/// Method addKey() will add a keyframe to a Vec2f track.
+		/// @param Track track: Track of the keyframe.
+		/// @param float time: Time of the keyframe.
+		/// @param Vec2f value: Value at the time.
+		/// @param util::Easing easing: Curve from the previous
+		///  keyframe to this one. By default it is Linear.
+		///////////////////////////////////////////////////////////
+		void addKey(Track track, float time, Vec2f value,
+			util::Easing easing = util::Easing::Linear);
+		///////////////////////////////////////////////////////////
+		/// Method addKey() will add a keyframe to a Color track.
+		/// @param Track track: Track of the keyframe.
+		/// @param float time: Time of the keyframe.
+		/// @param Color value: Value at the time.
+		/// @param util::Easing easing: Curve from the previous
+		///  keyframe to this one. By default it is Linear.
+		///////////////////////////////////////////////////////////
+		void addKey(Track track, float time, Color value,
+			util::Easing easing = util::Easing::Linear);
+
+		///////////////////////////////////////////////////////////
+		/// Method play() will start or resume the Timeline. A
+		/// finished Timeline restarts.
+		///////////////////////////////////////////////////////////
+		void play();
+		///////////////////////////////////////////////////////////
+		/// Method pause() will stop advancing the Timeline.
+		///////////////////////////////////////////////////////////
+		void pause();
+		///////////////////////////////////////////////////////////
+		/// Method seek() will jump to a time and write every track.
+		/// @param float time: Time in milliseconds. It is clamped.
+		///////////////////////////////////////////////////////////
+		void seek(float time);
+		///////////////////////////////////////////////////////////
+		/// Method setLooping() will make the Timeline start over
+		/// when it ends.
+		/// @param bool looping: True to loop.
+		///////////////////////////////////////////////////////////
+		void setLooping(bool looping);
+		///////////////////////////////////////////////////////////
+		/// Method setSpeed() will scale how fast time passes. By
+		/// default it is 1.
+		/// @param float speed: Time multiplier.
+		///////////////////////////////////////////////////////////
+		void setSpeed(float speed);
+		///////////////////////////////////////////////////////////
+		/// Method update() will advance the Timeline and write
+		/// every track that changed. Call it every frame.
+		/// @param float milliseconds: Time since the last update.
+		///////////////////////////////////////////////////////////
+		void update(float milliseconds);
+		///////////////////////////////////////////////////////////
+		/// Method clear() will remove all of the tracks.
+		///////////////////////////////////////////////////////////
+		void clear();
+
+		///////////////////////////////////////////////////////////
+		/// @returns float: Current time in milliseconds.
+		///////////////////////////////////////////////////////////
+		float getTime() const;
+		///////////////////////////////////////////////////////////
+		/// @returns float: Time of the last keyframe.
+		///////////////////////////////////////////////////////////
+		float getDuration() const;
+		///////////////////////////////////////////////////////////
+		/// @returns float: Time multiplier.
+		///////////////////////////////////////////////////////////
+		float getSpeed() const;
+		///////////////////////////////////////////////////////////
+		/// @returns bool: True if the Timeline is advancing.
+		///////////////////////////////////////////////////////////
+		bool isPlaying() const;
+		///////////////////////////////////////////////////////////
+		/// @returns bool: True if the Timeline loops.
+		///////////////////////////////////////////////////////////
+		bool isLooping() const;
+		///////////////////////////////////////////////////////////
+		/// @returns size_t: Number of tracks.
+		///////////////////////////////////////////////////////////
+		size_t getTrackCount() const;
+	protected:
+		/// Where a track writes its value.
+		enum class Output : std::uint8_t { Pointer, Position, Size, ScaleModifiers, StyleColor };
+
+		///////////////////////////////////////////////////////////
+		/// struct Keyframe is a value at a time.
+		///////////////////////////////////////////////////////////
+		template <typename Type>
+		struct Keyframe {
+			float time;
+			Type value;
+			util::Easing easing;
+		};
+
+		///////////////////////////////////////////////////////////
+		/// struct Channel is a track of a type.
+		///////////////////////////////////////////////////////////
+		template <typename Type>
+		struct Channel {
+			/// Keyframes sorted by time.
+			vector<Keyframe<Type>> keys;
+			/// Where the value is written.
+			Output output = Output::Pointer;
+			Type* value = nullptr;
+			Component* component = nullptr;
+			Button* button = nullptr;
+			Style* style = nullptr;
+			Color Style::* member = nullptr;
+			/// Keyframe the last evaluated time was after.
+			size_t segment = 0;
+			/// Last written value.
+			Type written = Type();
+			/// True if the value was written yet.
+			bool hasWritten = false;
+		};
+
+		/// Tracks by type.
+		vector<Channel<float>> floats;
+		vector<Channel<Vec2f>> vectors;
+		vector<Channel<Color>> colors;
+		/// Current time in milliseconds.
+		float time = 0.0f;
+		/// Time of the last keyframe.
+		float duration = 0.0f;
+		/// Time multiplier.
+		float speed = 1.0f;
+		/// True if advancing.
+		bool playing = false;
+		/// True if the Timeline starts over when it ends.
+		bool looping = false;
+
+		///////////////////////////////////////////////////////////
+		/// Method evaluate() will write every track at the current
+		/// time.
+		///////////////////////////////////////////////////////////
+		void evaluate();
+		///////////////////////////////////////////////////////////
+		/// Method insert() will add a keyframe in time order.
+		///////////////////////////////////////////////////////////
+		template <typename Type>
+		void insert(Channel<Type>& channel, const Keyframe<Type>& key);
+		///////////////////////////////////////////////////////////
+		/// Method sample() will find the value of a track at the
+		/// current time.
+		///////////////////////////////////////////////////////////
+		template <typename Type>
+		Type sample(Channel<Type>& channel) const;
+		///////////////////////////////////////////////////////////
+		/// Method write() will write a value if it changed.
+		///////////////////////////////////////////////////////////
+		template <typename Type>
+		static void write(Channel<Type>& channel, const Type& value);
+		///////////////////////////////////////////////////////////
+		/// Method output() will write a value to its target.
+		///////////////////////////////////////////////////////////
+		static void output(Channel<float>& channel, float value);
+		static void output(Channel<Vec2f>& channel, Vec2f value);
+		static void output(Channel<Color>& channel, Color value);
+		///////////////////////////////////////////////////////////
+		/// Method mix() will interpolate between two values.
+		///////////////////////////////////////////////////////////
+		static float mix(float a, float b, float t);
+		static Vec2f mix(Vec2f a, Vec2f b, float t);
+		static Color mix(Color a, Color b, float t);
+	};
+
+	///////////////////////////////////////////////////////////
+	/// Timeline
+	///////////////////////////////////////////////////////////
+
+	inline Timeline::Track Timeline::addFloat(float* value) {
+		floats.emplace_back();
+		floats.back().value = value;
+		return Track{ Track::Kind::Float, floats.size() - 1 };
+	}
+	inline Timeline::Track Timeline::addVector(Vec2f* value) {
+		vectors.emplace_back();
+		vectors.back().value = value;
+		return Track{ Track::Kind::Vector, vectors.size() - 1 };
+	}
+	inline Timeline::Track Timeline::addColor(Color* value) {
+		colors.emplace_back();
+		colors.back().value = value;
+		return Track{ Track::Kind::Color, colors.size() - 1 };
+	}
+	inline Timeline::Track Timeline::addPosition(Component& component) {
+		vectors.emplace_back();
+		vectors.back().output = Output::Position;
+		vectors.back().component = &component;
+		return Track{ Track::Kind::Vector, vectors.size() - 1 };
+	}
+	inline Timeline::Track Timeline::addSize(Button& button) {
+		vectors.emplace_back();
+		vectors.back().output = Output::Size;
+		vectors.back().button = &button;
+		return Track{ Track::Kind::Vector, vectors.size() - 1 };
+	}
+	inline Timeline::Track Timeline::addScaleModifiers(Button& button) {
+		floats.emplace_back();
+		floats.back().output = Output::ScaleModifiers;
+		floats.back().button = &button;
+		return Track{ Track::Kind::Float, floats.size() - 1 };
+	}
+	inline Timeline::Track Timeline::addStyleColor(Component& component, Style& style, Color Style::* color) {
+		colors.emplace_back();
+		colors.back().output = Output::StyleColor;
+		colors.back().component = &component;
+		colors.back().style = &style;
+		colors.back().member = color;
+		return Track{ Track::Kind::Color, colors.size() - 1 };
+	}
+
+	inline void Timeline::addKey(Track track, float time, float value, util::Easing easing) {
+		if (track.kind == Track::Kind::Float && track.index < floats.size())
+			insert(floats[track.index], Keyframe<float>{ time, value, easing });
+	}
+	inline void Timeline::addKey(Track track, float time, Vec2f value, util::Easing easing) {
+		if (track.kind == Track::Kind::Vector && track.index < vectors.size())
+			insert(vectors[track.index], Keyframe<Vec2f>{ time, value, easing });
+	}
+	inline void Timeline::addKey(Track track, float time, Color value, util::Easing easing) {
+		if (track.kind == Track::Kind::Color && track.index < colors.size())
+			insert(colors[track.index], Keyframe<Color>{ time, value, easing });
+	}
+
+	inline void Timeline::play() {
+		if (!looping && time >= duration)
+			time = 0.0f;
+		playing = true;
+		evaluate();
+	}
+	inline void Timeline::pause() {
+		playing = false;
+	}
+	inline void Timeline::seek(float time) {
+		this->time = std::max(0.0f, std::min(time, duration));
+		evaluate();
+	}
+	inline void Timeline::setLooping(bool looping) {
+		this->looping = looping;
+	}
+	inline void Timeline::setSpeed(float speed) {
+		this->speed = speed;
+	}
+	inline void Timeline::update(float milliseconds) {
+		if (!playing)
+			return;
+
+		GLASS_PROFILE_ZONE("Timeline::update");
+
+		time += milliseconds * speed;
+		if (time >= duration) {
+			if (looping && duration > 0.0f)
+				time = std::fmod(time, duration);
+			else {
+				time = duration;
+				playing = false;
+			}
+		}
+		else if (time < 0.0f)
+			time = 0.0f;
+
+		evaluate();
+	}
+	inline void Timeline::clear() {
+		floats.clear();
+		vectors.clear();
+		colors.clear();
+		time = 0.0f;
+		duration = 0.0f;
+		playing = false;
+	}
+
+	inline float Timeline::getTime() const {
+		return time;
+	}
+	inline float Timeline::getDuration() const {
+		return duration;
+	}
+	inline float Timeline::getSpeed() const {
+		return speed;
+	}
+	inline bool Timeline::isPlaying() const {
+		return playing;
+	}
+	inline bool Timeline::isLooping() const {
+		return looping;
+	}
+	inline size_t Timeline::getTrackCount() const {
+		return floats.size() + vectors.size() + colors.size();
+	}
+
+	inline void Timeline::evaluate() {
+		for (Channel<float>& channel : floats)
+			if (!channel.keys.empty())
+				write(channel, sample(channel));
+		for (Channel<Vec2f>& channel : vectors)
+			if (!channel.keys.empty())
+				write(channel, sample(channel));
+		for (Channel<Color>& channel : colors)
+			if (!channel.keys.empty())
+				write(channel, sample(channel));
+	}
+	template <typename Type>
+	inline void Timeline::insert(Channel<Type>& channel, const Keyframe<Type>& key) {
+		const auto position = std::upper_bound(channel.keys.begin(), channel.keys.end(), key.time,
+			[](float time, const Keyframe<Type>& other) { return time < other.time; });
+		channel.keys.insert(position, key);
+		channel.segment = 0;
+		duration = std::max(duration, key.time);
+	}
+	template <typename Type>
+	inline Type Timeline::sample(Channel<Type>& channel) const {
+		const vector<Keyframe<Type>>& keys = channel.keys;
+		size_t& segment = channel.segment;
+
+		// Time usually moves forward a little so the segment of the
+		// last sample is the place to start.
+		while (segment + 1 < keys.size() && keys[segment + 1].time <= time)
+			segment++;
+		while (segment > 0 && keys[segment].time > time)
+			segment--;
+
+		const Keyframe<Type>& from = keys[segment];
+		if (segment + 1 == keys.size() || time <= from.time)
+			return from.value;
+
+		const Keyframe<Type>& to = keys[segment + 1];
+		const float t = (time - from.time) / (to.time - from.time);
+		return mix(from.value, to.value, util::easeFast(to.easing, t));
+	}
+	template <typename Type>
+	inline void Timeline::write(Channel<Type>& channel, const Type& value) {
+		if (channel.hasWritten && channel.written == value)
+			return;
+
+		channel.written = value;
+		channel.hasWritten = true;
+		output(channel, value);
+	}
+	inline void Timeline::output(Channel<float>& channel, float value) {
+		if (channel.output == Output::ScaleModifiers)
+			channel.button->setScaleModifiers(value);
+		else
+			*channel.value = value;
+	}
+	inline void Timeline::output(Channel<Vec2f>& channel, Vec2f value) {
+		if (channel.output == Output::Position)
+			channel.component->setPosition(value);
+		else if (channel.output == Output::Size)
+			channel.button->setSize(value);
+		else
+			*channel.value = value;
+	}
+	inline void Timeline::output(Channel<Color>& channel, Color value) {
+		if (channel.output == Output::StyleColor) {
+			channel.style->*channel.member = value;
+			channel.component->applyStyle(*channel.style);
+		}
+		else
+			*channel.value = value;
+	}
+	inline float Timeline::mix(float a, float b, float t) {
+		return a + (b - a) * t;
+	}
+	inline Vec2f Timeline::mix(Vec2f a, Vec2f b, float t) {
+		return Vec2f(mix(a.x, b.x, t), mix(a.y, b.y, t));
+	}
+	inline Color Timeline::mix(Color a, Color b, float t) {
+		auto channel = [t](sf::Uint8 a, sf::Uint8 b) {
+			const float value = std::round(mix(static_cast<float>(a), static_cast<float>(b), t));
+			return static_cast<sf::Uint8>(value < 0.0f ? 0.0f : value > 255.0f ? 255.0f : value);
+		};
+		return Color(channel(a.r, b.r), channel(a.g, b.g), channel(a.b, b.b), channel(a.a, b.a));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,349 @@
+#pragma once
+
+// Dependencies
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+
+#include "../component.hpp"
+#include "profiler.hpp"
+
+namespace gs {
+	namespace util {
+		///////////////////////////////////////////////////////////
+		/// class Animator moves values toward their targets by a
+		/// percentage every frame like util::approach(), but only
+		/// holds the values that haven't reached their target yet.
+		/// Active tweens are kept in a dense array per type and
+		/// advanced in one loop by update(). A tween is removed as
+		/// soon as it reaches its target, so settled values cost
+		/// nothing. Objects that animate themselves, such as an
+		/// AnimatedButton, implement Animator::Animation and are
+		/// woken when they have something to animate.
+		///////////////////////////////////////////////////////////
+		class Animator {
+		public:
+			///////////////////////////////////////////////////////////
+			/// class Animation is an object that animates itself. It
+			/// is advanced every update() while it is awake.
+			///////////////////////////////////////////////////////////
+			class Animation {
+			public:
+				virtual ~Animation() = default;
+
+				///////////////////////////////////////////////////////////
+				/// Method advance() will move the animation one frame.
+				/// @returns bool: False once it settled and should
+				///  sleep.
+				///////////////////////////////////////////////////////////
+				virtual bool advance() = 0;
+			};
+
+			/// Distance at which a float or Vec2f tween snaps to its
+			/// target.
+			static constexpr float epsilon = 0.001f;
+
+			Animator() = default;
+			~Animator() = default;
+			Animator(const Animator&) = delete;
+			Animator& operator=(const Animator&) = delete;
+
+			///////////////////////////////////////////////////////////
+			/// Method animate() will move a value toward a target. If
+			/// the value is already animated it is given the new
+			/// target instead. The value must outlive the tween.
+			/// @param float* value: Value to animate.
+			/// @param float target: Final value.
+			/// @param float speed: Percentage of the distance covered
+			///  every frame. By default it is 25.
+			///////////////////////////////////////////////////////////
+			void animate(float* value, float target, float speed = 25.0f);
+			///////////////////////////////////////////////////////////
+			/// Method animate() will move a vector toward a target.
+			/// @param Vec2f* value: Vector to animate.
+			/// @param Vec2f target: Final vector.
+			/// @param float speed: Percentage of the distance covered
+			///  every frame. By default it is 25.
+			///////////////////////////////////////////////////////////
+			void animate(Vec2f* value, Vec2f target, float speed = 25.0f);
+			///////////////////////////////////////////////////////////
+			/// Method animate() will move a color toward a target.
+			/// Every channel moves at least 1 per frame so it always
+			/// reaches the target.
+			/// @param Color* value: Color to animate.
+			/// @param Color target: Final color.
+			/// @param float speed: Percentage of the distance covered
+			///  every frame. By default it is 25.
+			///////////////////////////////////////////////////////////
+			void animate(Color* value, Color target, float speed = 25.0f);
+			///////////////////////////////////////////////////////////
+			/// Method animatePosition() will move a Component toward
+			/// a position with setPosition().
+			/// @param Component& component: Component to move.
+			/// @param Vec2f target: Final position.
+			/// @param float speed: Percentage of the distance covered
+			///  every frame. By default it is 25.
+			///////////////////////////////////////////////////////////
+			void animatePosition(Component& component, Vec2f target, float speed = 25.0f);
+			///////////////////////////////////////////////////////////
+			/// Method wake() will advance an Animation every update()
+			/// until it settles. Waking an awake Animation does
+			/// nothing.
+			/// @param Animation& animation: Animation to wake.
+			///////////////////////////////////////////////////////////
+			void wake(Animation& animation);
+			///////////////////////////////////////////////////////////
+			/// Method stop() will remove the tween of a value, a
+			/// Component or an Animation where it is.
+			/// @param const void* key: Value, Component or Animation.
+			///////////////////////////////////////////////////////////
+			void stop(const void* key);
+			///////////////////////////////////////////////////////////
+			/// Method clear() will remove all of the tweens.
+			///////////////////////////////////////////////////////////
+			void clear();
+			///////////////////////////////////////////////////////////
+			/// Method update() will advance every active tween once
+			/// and remove the ones that settled. Call it every frame.
+			///////////////////////////////////////////////////////////
+			void update();
+
+			///////////////////////////////////////////////////////////
+			/// @param const void* key: Value, Component or Animation.
+			/// @returns bool: True if it is being animated.
+			///////////////////////////////////////////////////////////
+			bool isAnimating(const void* key) const;
+			///////////////////////////////////////////////////////////
+			/// @returns size_t: Number of active tweens.
+			///////////////////////////////////////////////////////////
+			size_t getActiveCount() const;
+		protected:
+			///////////////////////////////////////////////////////////
+			/// struct Tween is an active value and its target. The
+			/// value is written through a pointer or, for positions,
+			/// with setPosition().
+			///////////////////////////////////////////////////////////
+			template <typename Type>
+			struct Tween {
+				Type* value;
+				Type target;
+				float speed;
+				Component* component;
+				Type current;
+			};
+
+			/// Kinds of active tweens.
+			enum class Kind : std::uint8_t { Float, Vector, Color, Animation };
+
+			///////////////////////////////////////////////////////////
+			/// struct Slot is where the tween of a key is stored.
+			///////////////////////////////////////////////////////////
+			struct Slot {
+				Kind kind;
+				size_t index;
+			};
+
+			/// Active tweens by type.
+			vector<Tween<float>> floats;
+			vector<Tween<Vec2f>> vectors;
+			vector<Tween<Color>> colors;
+			vector<Animation*> animations;
+			/// Slot of every active key.
+			std::unordered_map<const void*, Slot> slots;
+
+			///////////////////////////////////////////////////////////
+			/// Method add() will add or retarget a tween.
+			///////////////////////////////////////////////////////////
+			template <typename Type>
+			void add(vector<Tween<Type>>& tweens, Kind kind, const void* key,
+				const Tween<Type>& tween);
+			///////////////////////////////////////////////////////////
+			/// Method remove() will swap remove the tween at an index.
+			///////////////////////////////////////////////////////////
+			template <typename Type>
+			void remove(vector<Type>& tweens, size_t index);
+			///////////////////////////////////////////////////////////
+			/// @returns const void*: Key of a tween.
+			///////////////////////////////////////////////////////////
+			template <typename Type>
+			static const void* keyOf(const Tween<Type>& tween);
+			///////////////////////////////////////////////////////////
+			/// @returns const void*: Key of an Animation.
+			///////////////////////////////////////////////////////////
+			static const void* keyOf(Animation* animation);
+
+			///////////////////////////////////////////////////////////
+			/// Method step() will move a value one frame.
+			/// @returns bool: True if it reached the target.
+			///////////////////////////////////////////////////////////
+			static bool step(float& value, float target, float speed);
+			static bool step(Vec2f& value, Vec2f target, float speed);
+			static bool step(Color& value, Color target, float speed);
+			static bool step(sf::Uint8& value, sf::Uint8 target, float speed);
+		};
+
+		///////////////////////////////////////////////////////////
+		/// Animator
+		///////////////////////////////////////////////////////////
+
+		inline void Animator::animate(float* value, float target, float speed) {
+			add(floats, Kind::Float, value, Tween<float>{ value, target, speed, nullptr, *value });
+		}
+		inline void Animator::animate(Vec2f* value, Vec2f target, float speed) {
+			add(vectors, Kind::Vector, value, Tween<Vec2f>{ value, target, speed, nullptr, *value });
+		}
+		inline void Animator::animate(Color* value, Color target, float speed) {
+			add(colors, Kind::Color, value, Tween<Color>{ value, target, speed, nullptr, *value });
+		}
+		inline void Animator::animatePosition(Component& component, Vec2f target, float speed) {
+			add(vectors, Kind::Vector, &component,
+				Tween<Vec2f>{ nullptr, target, speed, &component, component.getPosition() });
+		}
+		inline void Animator::wake(Animation& animation) {
+			if (slots.count(&animation) != 0)
+				return;
+
+			slots[&animation] = Slot{ Kind::Animation, animations.size() };
+			animations.push_back(&animation);
+		}
+		inline void Animator::stop(const void* key) {
+			const auto slot = slots.find(key);
+			if (slot == slots.end())
+				return;
+
+			const Slot found = slot->second;
+			switch (found.kind) {
+			case Kind::Float:
+				remove(floats, found.index);
+				break;
+			case Kind::Vector:
+				remove(vectors, found.index);
+				break;
+			case Kind::Color:
+				remove(colors, found.index);
+				break;
+			case Kind::Animation:
+				remove(animations, found.index);
+				break;
+			}
+		}
+		inline void Animator::clear() {
+			floats.clear();
+			vectors.clear();
+			colors.clear();
+			animations.clear();
+			slots.clear();
+		}
+		inline void Animator::update() {
+			GLASS_PROFILE_ZONE("Animator::update");
+
+			for (size_t i = 0; i < floats.size();) {
+				Tween<float>& tween = floats[i];
+				const bool settled = step(*tween.value, tween.target, tween.speed);
+				if (settled)
+					remove(floats, i);
+				else
+					i++;
+			}
+			for (size_t i = 0; i < vectors.size();) {
+				Tween<Vec2f>& tween = vectors[i];
+				Vec2f& value = tween.component != nullptr ? tween.current : *tween.value;
+				const bool settled = step(value, tween.target, tween.speed);
+
+				if (tween.component != nullptr)
+					tween.component->setPosition(value);
+				if (settled)
+					remove(vectors, i);
+				else
+					i++;
+			}
+			for (size_t i = 0; i < colors.size();) {
+				Tween<Color>& tween = colors[i];
+				const bool settled = step(*tween.value, tween.target, tween.speed);
+				if (settled)
+					remove(colors, i);
+				else
+					i++;
+			}
+			for (size_t i = 0; i < animations.size();) {
+				if (!animations[i]->advance())
+					remove(animations, i);
+				else
+					i++;
+			}
+		}
+
+		inline bool Animator::isAnimating(const void* key) const {
+			return slots.count(key) != 0;
+		}
+		inline size_t Animator::getActiveCount() const {
+			return slots.size();
+		}
+
+		template <typename Type>
+		inline void Animator::add(vector<Tween<Type>>& tweens, Kind kind, const void* key,
+			const Tween<Type>& tween) {
+			const auto slot = slots.find(key);
+			if (slot != slots.end() && slot->second.kind == kind) {
+				Tween<Type>& active = tweens[slot->second.index];
+				active.target = tween.target;
+				active.speed = tween.speed;
+				return;
+			}
+			if (slot != slots.end())
+				stop(key);
+
+			slots[key] = Slot{ kind, tweens.size() };
+			tweens.push_back(tween);
+		}
+		template <typename Type>
+		inline void Animator::remove(vector<Type>& tweens, size_t index) {
+			slots.erase(keyOf(tweens[index]));
+
+			if (index + 1 != tweens.size()) {
+				tweens[index] = tweens.back();
+				slots[keyOf(tweens[index])].index = index;
+			}
+			tweens.pop_back();
+		}
+		template <typename Type>
+		inline const void* Animator::keyOf(const Tween<Type>& tween) {
+			if (tween.component != nullptr)
+				return tween.component;
+			return tween.value;
+		}
+		inline const void* Animator::keyOf(Animation* animation) {
+			return animation;
+		}
+
+		inline bool Animator::step(float& value, float target, float speed) {
+			value += (target - value) * speed * 0.01f;
+			if (std::fabs(target - value) < epsilon) {
+				value = target;
+				return true;
+			}
+			return false;
+		}
+		inline bool Animator::step(Vec2f& value, Vec2f target, float speed) {
+			const bool x = step(value.x, target.x, speed);
+			const bool y = step(value.y, target.y, speed);
+			return x && y;
+		}
+		inline bool Animator::step(Color& value, Color target, float speed) {
+			const bool r = step(value.r, target.r, speed);
+			const bool g = step(value.g, target.g, speed);
+			const bool b = step(value.b, target.b, speed);
+			const bool a = step(value.a, target.a, speed);
+			return r && g && b && a;
+		}
+		inline bool Animator::step(sf::Uint8& value, sf::Uint8 target, float speed) {
+			const int distance = static_cast<int>(target) - static_cast<int>(value);
+			int change = static_cast<int>(distance * speed * 0.01f);
+			if (change == 0 && distance != 0)
+				change = distance > 0 ? 1 : -1;
+
+			value = static_cast<sf::Uint8>(value + change);
+			return value == target;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,218 @@
+#pragma once
+
+// Dependencies
+#include <cstdint>
+
+#include "math.hpp"
+
+#if !defined(GLASS_DISABLE_SIMD) && defined(__AVX2__)
+	#include <immintrin.h>
+	/// Defined if batch approach() moves 8 colors or floats at once.
+	#define GLASS_APPROACH_AVX2
+#elif !defined(GLASS_DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64) \
+	|| (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+	#include <emmintrin.h>
+	/// Defined if batch approach() moves 4 colors or floats at once.
+	#define GLASS_APPROACH_SSE
+#endif
+
+namespace gs {
+	namespace util {
+		///////////////////////////////////////////////////////////
+		/// Function approach() will move every color of an array
+		/// in the direction of its destination a given percentage
+		/// like approach(Color*, Color, float) does for one color.
+		/// Channels are moved in float lanes with SSE2 or AVX2
+		/// when available, so the colors of a whole Menu can be
+		/// moved in one call. The result is the same as the dll's
+		/// approach(), including percentages outside 0 to 100.
+		/// @param Color* values: Colors needing to be modified.
+		/// @param const Color* destinations: Final colors.
+		/// @param size_t count: Number of colors.
+		/// @param float percentage: Distance to cover between
+		///  color values.
+		///////////////////////////////////////////////////////////
+		inline void approach(Color* values, const Color* destinations,
+			size_t count, float percentage);
+		///////////////////////////////////////////////////////////
+		/// Function approach() will move every value of an array
+		/// in the direction of its destination a given percentage.
+		/// @param float* values: Values needing to be modified.
+		/// @param const float* destinations: Final values.
+		/// @param size_t count: Number of values.
+		/// @param float percentage: Distance to cover between
+		///  values.
+		///////////////////////////////////////////////////////////
+		inline void approach(float* values, const float* destinations,
+			size_t count, float percentage);
+
+		///////////////////////////////////////////////////////////
+		/// @returns const char*: "AVX2", "SSE" or "Scalar"
+		///  depending on what batch approach() was compiled with.
+		///////////////////////////////////////////////////////////
+		inline const char* getApproachInstructionSet();
+	}
+
+	namespace priv {
+		static_assert(sizeof(Color) == 4, "Color must be 4 packed channels");
+
+		///////////////////////////////////////////////////////////
+		/// @param float percentage: Percentage to cover.
+		/// @returns float: Factor which is 1 at 100 percent. Like
+		///  the dll it is divided and not clamped.
+		///////////////////////////////////////////////////////////
+		inline float approachFactor(float percentage) {
+			return percentage / 100.0f;
+		}
+		///////////////////////////////////////////////////////////
+		/// Function approachScalar() will move channels one at a
+		/// time. It is the fallback of batch approach() and
+		/// handles what is left after the SIMD blocks. Channels
+		/// keep the low byte of the truncated result like the dll.
+		/// @param std::uint8_t* values: Channels to modify.
+		/// @param const std::uint8_t* destinations: Final channels.
+		/// @param size_t count: Number of channels.
+		/// @param float factor: Factor from 0 to 1.
+		///////////////////////////////////////////////////////////
+		inline void approachScalar(std::uint8_t* values,
+			const std::uint8_t* destinations, size_t count, float factor) {
+			for (size_t i = 0; i < count; i++) {
+				const float base = static_cast<float>(values[i]);
+				const float target = static_cast<float>(destinations[i]);
+				values[i] = static_cast<std::uint8_t>(
+					static_cast<int>(base + (target - base) * factor));
+			}
+		}
+		///////////////////////////////////////////////////////////
+		/// Function approachScalar() will move floats one at a
+		/// time.
+		/// @param float* values: Values to modify.
+		/// @param const float* destinations: Final values.
+		/// @param size_t count: Number of values.
+		/// @param float factor: Factor from 0 to 1.
+		///////////////////////////////////////////////////////////
+		inline void approachScalar(float* values,
+			const float* destinations, size_t count, float factor) {
+			for (size_t i = 0; i < count; i++)
+				values[i] = values[i] + (destinations[i] - values[i]) * factor;
+		}
+	}
+
+	namespace util {
+		///////////////////////////////////////////////////////////
+		/// approach
+		///////////////////////////////////////////////////////////
+
+		inline void approach(Color* values, const Color* destinations,
+			size_t count, float percentage) {
+			const float factor = priv::approachFactor(percentage);
+			std::uint8_t* channels = reinterpret_cast<std::uint8_t*>(values);
+			const std::uint8_t* targets = reinterpret_cast<const std::uint8_t*>(destinations);
+			size_t i = 0;
+
+		#if defined(GLASS_APPROACH_AVX2)
+			const __m256 factors = _mm256_set1_ps(factor);
+			// Keeps the low byte so the packs below can't saturate.
+			const __m256i lowByte = _mm256_set1_epi32(0xFF);
+			// Undoes the lane interleaving of the 256 bit packs.
+			const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+			auto lerp = [&factors, &lowByte](const std::uint8_t* value, const std::uint8_t* target) {
+				const __m256 base = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(
+					_mm_loadl_epi64(reinterpret_cast<const __m128i*>(value))));
+				const __m256 destination = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(
+					_mm_loadl_epi64(reinterpret_cast<const __m128i*>(target))));
+				return _mm256_and_si256(_mm256_cvttps_epi32(_mm256_add_ps(base,
+					_mm256_mul_ps(_mm256_sub_ps(destination, base), factors))), lowByte);
+			};
+
+			// 8 colors are 32 channels.
+			for (; i + 8 <= count; i += 8) {
+				std::uint8_t* value = channels + i * 4;
+				const std::uint8_t* target = targets + i * 4;
+
+				const __m256i a = lerp(value, target);
+				const __m256i b = lerp(value + 8, target + 8);
+				const __m256i c = lerp(value + 16, target + 16);
+				const __m256i d = lerp(value + 24, target + 24);
+				const __m256i packed = _mm256_packus_epi16(
+					_mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(value),
+					_mm256_permutevar8x32_epi32(packed, order));
+			}
+		#elif defined(GLASS_APPROACH_SSE)
+			const __m128 factors = _mm_set1_ps(factor);
+			const __m128i zero = _mm_setzero_si128();
+			// Keeps the low byte so the packs below can't saturate.
+			const __m128i lowByte = _mm_set1_epi32(0xFF);
+
+			auto lerp = [&factors, &lowByte](__m128i value, __m128i target) {
+				const __m128 base = _mm_cvtepi32_ps(value);
+				return _mm_and_si128(_mm_cvttps_epi32(_mm_add_ps(base,
+					_mm_mul_ps(_mm_sub_ps(_mm_cvtepi32_ps(target), base), factors))), lowByte);
+			};
+
+			// 4 colors are 16 channels.
+			for (; i + 4 <= count; i += 4) {
+				__m128i* value = reinterpret_cast<__m128i*>(channels + i * 4);
+				const __m128i base = _mm_loadu_si128(value);
+				const __m128i destination = _mm_loadu_si128(
+					reinterpret_cast<const __m128i*>(targets + i * 4));
+
+				const __m128i baseLow = _mm_unpacklo_epi8(base, zero);
+				const __m128i baseHigh = _mm_unpackhi_epi8(base, zero);
+				const __m128i destinationLow = _mm_unpacklo_epi8(destination, zero);
+				const __m128i destinationHigh = _mm_unpackhi_epi8(destination, zero);
+
+				const __m128i a = lerp(_mm_unpacklo_epi16(baseLow, zero),
+					_mm_unpacklo_epi16(destinationLow, zero));
+				const __m128i b = lerp(_mm_unpackhi_epi16(baseLow, zero),
+					_mm_unpackhi_epi16(destinationLow, zero));
+				const __m128i c = lerp(_mm_unpacklo_epi16(baseHigh, zero),
+					_mm_unpacklo_epi16(destinationHigh, zero));
+				const __m128i d = lerp(_mm_unpackhi_epi16(baseHigh, zero),
+					_mm_unpackhi_epi16(destinationHigh, zero));
+				_mm_storeu_si128(value, _mm_packus_epi16(
+					_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+			}
+		#endif
+
+			priv::approachScalar(channels + i * 4, targets + i * 4, (count - i) * 4, factor);
+		}
+		inline void approach(float* values, const float* destinations,
+			size_t count, float percentage) {
+			const float factor = priv::approachFactor(percentage);
+			size_t i = 0;
+
+		#if defined(GLASS_APPROACH_AVX2)
+			const __m256 factors = _mm256_set1_ps(factor);
+			for (; i + 8 <= count; i += 8) {
+				const __m256 base = _mm256_loadu_ps(values + i);
+				const __m256 destination = _mm256_loadu_ps(destinations + i);
+				_mm256_storeu_ps(values + i, _mm256_add_ps(base,
+					_mm256_mul_ps(_mm256_sub_ps(destination, base), factors)));
+			}
+		#elif defined(GLASS_APPROACH_SSE)
+			const __m128 factors = _mm_set1_ps(factor);
+			for (; i + 4 <= count; i += 4) {
+				const __m128 base = _mm_loadu_ps(values + i);
+				const __m128 destination = _mm_loadu_ps(destinations + i);
+				_mm_storeu_ps(values + i, _mm_add_ps(base,
+					_mm_mul_ps(_mm_sub_ps(destination, base), factors)));
+			}
+		#endif
+
+			priv::approachScalar(values + i, destinations + i, count - i, factor);
+		}
+
+		inline const char* getApproachInstructionSet() {
+		#if defined(GLASS_APPROACH_AVX2)
+			return "AVX2";
+		#elif defined(GLASS_APPROACH_SSE)
+			return "SSE";
+		#else
+			return "Scalar";
+		#endif
+		}
+	}
+}
\ No newline at end of file
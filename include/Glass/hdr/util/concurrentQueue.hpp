@@ -0,0 +1,265 @@
+#pragma once
+
+// Dependencies
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include "../typedef.hpp"
+
+namespace gs {
+	namespace priv {
+		///////////////////////////////////////////////////////////
+		/// Function roundUpPowerOfTwo() will round a capacity up
+		/// to a power of two so indices can wrap with a mask.
+		/// @param size_t value: Value to round.
+		/// @returns size_t: Smallest power of two >= value.
+		///////////////////////////////////////////////////////////
+		inline size_t roundUpPowerOfTwo(size_t value) {
+			size_t result = 1;
+			while (result < value)
+				result <<= 1;
+			return result;
+		}
+	}
+
+	namespace util {
+		///////////////////////////////////////////////////////////
+		/// class SpscQueue is a bounded single producer single
+		/// consumer queue. push() and pop() are wait-free and
+		/// never allocate. Exactly one thread may push and exactly
+		/// one other thread may pop.
+		///////////////////////////////////////////////////////////
+		template <typename Type>
+		class SpscQueue {
+		public:
+			///////////////////////////////////////////////////////////
+			/// @param size_t capacity: Minimum number of values the
+			///  queue can hold. It is rounded up to a power of two.
+			///////////////////////////////////////////////////////////
+			explicit SpscQueue(size_t capacity);
+			~SpscQueue() = default;
+			SpscQueue(const SpscQueue&) = delete;
+			SpscQueue& operator=(const SpscQueue&) = delete;
+
+			///////////////////////////////////////////////////////////
+			/// Method push() will add a value. Producer thread only.
+			/// @param const Type& value: Value to add.
+			/// @returns bool: False if the queue was full.
+			///////////////////////////////////////////////////////////
+			bool push(const Type& value);
+			///////////////////////////////////////////////////////////
+			/// Method pop() will remove the oldest value. Consumer
+			/// thread only.
+			/// @param Type& value: Where to store the value.
+			/// @returns bool: False if the queue was empty.
+			///////////////////////////////////////////////////////////
+			bool pop(Type& value);
+			///////////////////////////////////////////////////////////
+			/// Method popBulk() will remove up to maxCount of the
+			/// oldest values at once. Consumer thread only.
+			/// @param Type* values: Where to store the values.
+			/// @param size_t maxCount: Maximum values to remove.
+			/// @returns size_t: Number of values removed.
+			///////////////////////////////////////////////////////////
+			size_t popBulk(Type* values, size_t maxCount);
+
+			///////////////////////////////////////////////////////////
+			/// @returns size_t: Maximum number of values.
+			///////////////////////////////////////////////////////////
+			size_t capacity() const;
+		protected:
+			/// Storage of the values.
+			vector<Type> values;
+			/// capacity() - 1.
+			size_t mask;
+			/// Next index to pop. Written by the consumer.
+			alignas(64) std::atomic<size_t> head{ 0 };
+			/// Consumers last seen tail.
+			size_t cachedTail = 0;
+			/// Next index to push. Written by the producer.
+			alignas(64) std::atomic<size_t> tail{ 0 };
+			/// Producers last seen head.
+			size_t cachedHead = 0;
+		};
+
+		///////////////////////////////////////////////////////////
+		/// class MpscQueue is a bounded multiple producer single
+		/// consumer queue. Every slot has a sequence number so
+		/// producers only race on reserving a slot. push() is
+		/// lock-free, pop() is wait-free and neither allocates.
+		///////////////////////////////////////////////////////////
+		template <typename Type>
+		class MpscQueue {
+		public:
+			///////////////////////////////////////////////////////////
+			/// @param size_t capacity: Minimum number of values the
+			///  queue can hold. It is rounded up to a power of two.
+			///////////////////////////////////////////////////////////
+			explicit MpscQueue(size_t capacity);
+			~MpscQueue() = default;
+			MpscQueue(const MpscQueue&) = delete;
+			MpscQueue& operator=(const MpscQueue&) = delete;
+
+			///////////////////////////////////////////////////////////
+			/// Method push() will add a value. Any thread.
+			/// @param const Type& value: Value to add.
+			/// @returns bool: False if the queue was full.
+			///////////////////////////////////////////////////////////
+			bool push(const Type& value);
+			///////////////////////////////////////////////////////////
+			/// Method pop() will remove the oldest value. Consumer
+			/// thread only.
+			/// @param Type& value: Where to store the value.
+			/// @returns bool: False if the queue was empty or the
+			///  oldest value is still being written.
+			///////////////////////////////////////////////////////////
+			bool pop(Type& value);
+			///////////////////////////////////////////////////////////
+			/// Method popBulk() will remove up to maxCount of the
+			/// oldest values at once. Consumer thread only.
+			/// @param Type* values: Where to store the values.
+			/// @param size_t maxCount: Maximum values to remove.
+			/// @returns size_t: Number of values removed.
+			///////////////////////////////////////////////////////////
+			size_t popBulk(Type* values, size_t maxCount);
+
+			///////////////////////////////////////////////////////////
+			/// @returns size_t: Maximum number of values.
+			///////////////////////////////////////////////////////////
+			size_t capacity() const;
+		protected:
+			///////////////////////////////////////////////////////////
+			/// struct Cell is a slot of the queue. Its sequence is
+			/// its index when free and index + 1 when written.
+			///////////////////////////////////////////////////////////
+			struct Cell {
+				std::atomic<size_t> sequence;
+				Type value;
+			};
+
+			/// Storage of the values.
+			std::unique_ptr<Cell[]> cells;
+			/// capacity() - 1.
+			size_t mask;
+			/// Next index to pop. Only used by the consumer.
+			alignas(64) size_t head = 0;
+			/// Next index to reserve. Shared by the producers.
+			alignas(64) std::atomic<size_t> tail{ 0 };
+		};
+
+		///////////////////////////////////////////////////////////
+		/// SpscQueue
+		///////////////////////////////////////////////////////////
+
+		template <typename Type>
+		inline SpscQueue<Type>::SpscQueue(size_t capacity)
+			: values(priv::roundUpPowerOfTwo(capacity)),
+			mask(values.size() - 1) {
+		}
+
+		template <typename Type>
+		inline bool SpscQueue<Type>::push(const Type& value) {
+			const size_t index = tail.load(std::memory_order_relaxed);
+
+			// Only reload the consumers index when the queue looks full.
+			if (index - cachedHead == values.size()) {
+				cachedHead = head.load(std::memory_order_acquire);
+				if (index - cachedHead == values.size())
+					return false;
+			}
+
+			values[index & mask] = value;
+			tail.store(index + 1, std::memory_order_release);
+			return true;
+		}
+		template <typename Type>
+		inline bool SpscQueue<Type>::pop(Type& value) {
+			return popBulk(&value, 1) == 1;
+		}
+		template <typename Type>
+		inline size_t SpscQueue<Type>::popBulk(Type* values, size_t maxCount) {
+			const size_t index = head.load(std::memory_order_relaxed);
+
+			if (cachedTail - index < maxCount)
+				cachedTail = tail.load(std::memory_order_acquire);
+
+			size_t count = cachedTail - index;
+			if (count > maxCount)
+				count = maxCount;
+
+			for (size_t i = 0; i < count; i++)
+				values[i] = this->values[(index + i) & mask];
+
+			head.store(index + count, std::memory_order_release);
+			return count;
+		}
+
+		template <typename Type>
+		inline size_t SpscQueue<Type>::capacity() const {
+			return values.size();
+		}
+
+		///////////////////////////////////////////////////////////
+		/// MpscQueue
+		///////////////////////////////////////////////////////////
+
+		template <typename Type>
+		inline MpscQueue<Type>::MpscQueue(size_t capacity)
+			: mask(priv::roundUpPowerOfTwo(capacity) - 1) {
+			cells.reset(new Cell[mask + 1]);
+			for (size_t i = 0; i <= mask; i++)
+				cells[i].sequence.store(i, std::memory_order_relaxed);
+		}
+
+		template <typename Type>
+		inline bool MpscQueue<Type>::push(const Type& value) {
+			size_t index = tail.load(std::memory_order_relaxed);
+			Cell* cell;
+
+			while (true) {
+				cell = &cells[index & mask];
+				const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+				const std::ptrdiff_t difference =
+					static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(index);
+
+				if (difference == 0) {
+					if (tail.compare_exchange_weak(index, index + 1, std::memory_order_relaxed))
+						break;
+				}
+				else if (difference < 0)
+					return false;
+				else
+					index = tail.load(std::memory_order_relaxed);
+			}
+
+			cell->value = value;
+			cell->sequence.store(index + 1, std::memory_order_release);
+			return true;
+		}
+		template <typename Type>
+		inline bool MpscQueue<Type>::pop(Type& value) {
+			Cell& cell = cells[head & mask];
+
+			if (cell.sequence.load(std::memory_order_acquire) != head + 1)
+				return false;
+
+			value = cell.value;
+			cell.sequence.store(head + mask + 1, std::memory_order_release);
+			head++;
+			return true;
+		}
+		template <typename Type>
+		inline size_t MpscQueue<Type>::popBulk(Type* values, size_t maxCount) {
+			size_t count = 0;
+			while (count < maxCount && pop(values[count]))
+				count++;
+			return count;
+		}
+
+		template <typename Type>
+		inline size_t MpscQueue<Type>::capacity() const {
+			return mask + 1;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,178 @@
+#pragma once
+
+// Dependencies
+#include <array>
+#include <cmath>
+
+#include "../typedef.hpp"
+
+namespace gs {
+	namespace util {
+		/// Standard easing curves. In curves start slow, Out curves
+		/// end slow and InOut curves do both.
+		enum class Easing {
+			Linear,
+			QuadIn, QuadOut, QuadInOut,
+			CubicIn, CubicOut, CubicInOut,
+			SineIn, SineOut, SineInOut,
+			ExpoIn, ExpoOut, ExpoInOut,
+			BackIn, BackOut, BackInOut,
+			ElasticOut, BounceOut,
+			Count
+		};
+
+		///////////////////////////////////////////////////////////
+		/// Function ease() will evaluate an easing curve exactly.
+		/// @param Easing easing: Curve to evaluate.
+		/// @param float t: Progress from 0 to 1. It is clamped.
+		/// @returns float: Eased progress. 0 at 0 and 1 at 1, Back
+		///  and Elastic curves overshoot in between.
+		///////////////////////////////////////////////////////////
+		inline float ease(Easing easing, float t);
+
+		///////////////////////////////////////////////////////////
+		/// class EasingTable holds every easing curve sampled at
+		/// regular steps so evaluating one is a lookup and a lerp
+		/// instead of calls to pow(), sin() and cos(). There is a
+		/// single shared table built on first use.
+		///////////////////////////////////////////////////////////
+		class EasingTable {
+		public:
+			/// Intervals each curve is sampled at.
+			static const size_t resolution = 256;
+
+			///////////////////////////////////////////////////////////
+			/// @returns const EasingTable&: Shared table.
+			///////////////////////////////////////////////////////////
+			static const EasingTable& get();
+
+			///////////////////////////////////////////////////////////
+			/// Method evaluate() will evaluate an easing curve from
+			/// the table.
+			/// @param Easing easing: Curve to evaluate.
+			/// @param float t: Progress from 0 to 1. It is clamped.
+			/// @returns float: Eased progress.
+			///////////////////////////////////////////////////////////
+			float evaluate(Easing easing, float t) const;
+		protected:
+			/// Samples of every curve one after another.
+			std::array<float, static_cast<size_t>(Easing::Count) * (resolution + 1)> samples;
+
+			EasingTable();
+		};
+
+		///////////////////////////////////////////////////////////
+		/// Function easeFast() will evaluate an easing curve from
+		/// the shared EasingTable.
+		/// @param Easing easing: Curve to evaluate.
+		/// @param float t: Progress from 0 to 1. It is clamped.
+		/// @returns float: Eased progress.
+		///////////////////////////////////////////////////////////
+		inline float easeFast(Easing easing, float t) {
+			return EasingTable::get().evaluate(easing, t);
+		}
+
+		///////////////////////////////////////////////////////////
+		/// ease
+		///////////////////////////////////////////////////////////
+
+		inline float ease(Easing easing, float t) {
+			const float pi = 3.14159265f;
+			const float back = 1.70158f, backInOut = back * 1.525f;
+
+			t = t < 0.0f ? 0.0f : t > 1.0f ? 1.0f : t;
+
+			switch (easing) {
+			case Easing::QuadIn:
+				return t * t;
+			case Easing::QuadOut:
+				return 1.0f - (1.0f - t) * (1.0f - t);
+			case Easing::QuadInOut:
+				return t < 0.5f ? 2.0f * t * t
+					: 1.0f - (2.0f - 2.0f * t) * (2.0f - 2.0f * t) * 0.5f;
+			case Easing::CubicIn:
+				return t * t * t;
+			case Easing::CubicOut:
+				return 1.0f - (1.0f - t) * (1.0f - t) * (1.0f - t);
+			case Easing::CubicInOut:
+				return t < 0.5f ? 4.0f * t * t * t
+					: 1.0f - (2.0f - 2.0f * t) * (2.0f - 2.0f * t) * (2.0f - 2.0f * t) * 0.5f;
+			case Easing::SineIn:
+				return 1.0f - std::cos(t * pi * 0.5f);
+			case Easing::SineOut:
+				return std::sin(t * pi * 0.5f);
+			case Easing::SineInOut:
+				return (1.0f - std::cos(t * pi)) * 0.5f;
+			case Easing::ExpoIn:
+				return t == 0.0f ? 0.0f : std::pow(2.0f, 10.0f * t - 10.0f);
+			case Easing::ExpoOut:
+				return t == 1.0f ? 1.0f : 1.0f - std::pow(2.0f, -10.0f * t);
+			case Easing::ExpoInOut:
+				if (t == 0.0f || t == 1.0f)
+					return t;
+				return t < 0.5f ? std::pow(2.0f, 20.0f * t - 10.0f) * 0.5f
+					: (2.0f - std::pow(2.0f, 10.0f - 20.0f * t)) * 0.5f;
+			case Easing::BackIn:
+				return (back + 1.0f) * t * t * t - back * t * t;
+			case Easing::BackOut:
+				return 1.0f + (back + 1.0f) * (t - 1.0f) * (t - 1.0f) * (t - 1.0f)
+					+ back * (t - 1.0f) * (t - 1.0f);
+			case Easing::BackInOut: {
+				const float u = 2.0f * t;
+				return t < 0.5f ? u * u * ((backInOut + 1.0f) * u - backInOut) * 0.5f
+					: ((u - 2.0f) * (u - 2.0f) * ((backInOut + 1.0f) * (u - 2.0f) + backInOut) + 2.0f) * 0.5f;
+			}
+			case Easing::ElasticOut:
+				if (t == 0.0f || t == 1.0f)
+					return t;
+				return std::pow(2.0f, -10.0f * t) * std::sin((t * 10.0f - 0.75f) * (2.0f * pi / 3.0f)) + 1.0f;
+			case Easing::BounceOut: {
+				const float n = 7.5625f, d = 2.75f;
+				if (t < 1.0f / d)
+					return n * t * t;
+				if (t < 2.0f / d) {
+					t -= 1.5f / d;
+					return n * t * t + 0.75f;
+				}
+				if (t < 2.5f / d) {
+					t -= 2.25f / d;
+					return n * t * t + 0.9375f;
+				}
+				t -= 2.625f / d;
+				return n * t * t + 0.984375f;
+			}
+			default:
+				return t;
+			}
+		}
+
+		///////////////////////////////////////////////////////////
+		/// EasingTable
+		///////////////////////////////////////////////////////////
+
+		inline const EasingTable& EasingTable::get() {
+			static const EasingTable table;
+			return table;
+		}
+
+		inline float EasingTable::evaluate(Easing easing, float t) const {
+			if (!(t > 0.0f))
+				return 0.0f;
+			if (t >= 1.0f)
+				return 1.0f;
+
+			const float position = t * resolution;
+			const size_t index = static_cast<size_t>(position);
+			const float fraction = position - static_cast<float>(index);
+			const float* curve = samples.data() + static_cast<size_t>(easing) * (resolution + 1);
+			return curve[index] + (curve[index + 1] - curve[index]) * fraction;
+		}
+
+		inline EasingTable::EasingTable() {
+			for (size_t curve = 0; curve < static_cast<size_t>(Easing::Count); curve++)
+				for (size_t i = 0; i <= resolution; i++)
+					samples[curve * (resolution + 1) + i] = ease(static_cast<Easing>(curve),
+						static_cast<float>(i) / static_cast<float>(resolution));
+		}
+	}
+}
\ No newline at end of file
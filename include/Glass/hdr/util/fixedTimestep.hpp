@@ -0,0 +1,325 @@
+#pragma once
+
+// Dependencies
+#include <chrono>
+
+#include "../component.hpp"
+#include "profiler.hpp"
+
+namespace gs {
+	namespace priv {
+		///////////////////////////////////////////////////////////
+		/// Function interpolate() will blend between two values.
+		/// @param const Type& from: Value when alpha is 0.
+		/// @param const Type& to: Value when alpha is 1.
+		/// @param float alpha: Blend factor from 0 to 1.
+		/// @returns Type: Blended value.
+		///////////////////////////////////////////////////////////
+		template <typename Type>
+		inline Type interpolate(const Type& from, const Type& to, float alpha) {
+			return from + (to - from) * alpha;
+		}
+		///////////////////////////////////////////////////////////
+		/// Function interpolate() will blend between two colors
+		/// one channel at a time.
+		/// @param const Color& from: Color when alpha is 0.
+		/// @param const Color& to: Color when alpha is 1.
+		/// @param float alpha: Blend factor from 0 to 1.
+		/// @returns Color: Blended color.
+		///////////////////////////////////////////////////////////
+		inline Color interpolate(const Color& from, const Color& to, float alpha) {
+			auto channel = [alpha](sf::Uint8 a, sf::Uint8 b) {
+				return static_cast<sf::Uint8>(a + (b - a) * alpha + 0.5f);
+			};
+			return Color(
+				channel(from.r, to.r), channel(from.g, to.g),
+				channel(from.b, to.b), channel(from.a, to.a)
+			);
+		}
+	}
+
+	namespace util {
+		///////////////////////////////////////////////////////////
+		/// class FixedTimestep runs updates at a fixed tick rate no
+		/// matter how fast frames are rendered. Button and Slider
+		/// animations and Transition::inc advance a fixed amount
+		/// per update() call, so updating them once per tick makes
+		/// them behave the same at 30 and 240 frames per second.
+		/// Example:
+		///
+		/// gs::util::FixedTimestep timestep(120);
+		///
+		/// while (window.isOpen()) {
+		/// 	clock.begin();
+		/// 	timestep.run([&]() {
+		/// 		gs::input::updateInputs();
+		/// 		menu.update();
+		/// 	});
+		/// 	position.get(timestep.getAlpha());
+		/// 	...
+		/// 	clock.end();
+		/// 	clock.wait(240);
+		/// }
+		///
+		/// Call gs::input::updateInputs() inside the tick so that
+		/// a click is seen by exactly one tick.
+		///////////////////////////////////////////////////////////
+		class FixedTimestep {
+		public:
+			/// Alias for std::chrono::steady_clock.
+			typedef std::chrono::steady_clock SteadyClock;
+
+			///////////////////////////////////////////////////////////
+			/// @param unsigned int tickRate: Ticks per second.
+			///////////////////////////////////////////////////////////
+			explicit FixedTimestep(unsigned int tickRate = 60);
+			~FixedTimestep() = default;
+
+			///////////////////////////////////////////////////////////
+			/// Method advance() will add the time since the last call
+			/// and find how many ticks are due. The first call only
+			/// starts the timer. Note: run() and update() call this.
+			/// @returns unsigned int: Number of ticks to run now.
+			///////////////////////////////////////////////////////////
+			unsigned int advance();
+			///////////////////////////////////////////////////////////
+			/// Method advance() will add a duration and find how many
+			/// ticks are due. Use it to drive the timestep from your
+			/// own clock or for deterministic playback.
+			/// @param float milliseconds: Time since the last call.
+			/// @returns unsigned int: Number of ticks to run now.
+			///////////////////////////////////////////////////////////
+			unsigned int advance(float milliseconds);
+			///////////////////////////////////////////////////////////
+			/// Method run() will call a function once for every tick
+			/// that is due.
+			/// @param Function&& tick: Function taking no arguments.
+			/// @returns unsigned int: Number of ticks run.
+			///////////////////////////////////////////////////////////
+			template <typename Function>
+			unsigned int run(Function&& tick);
+			///////////////////////////////////////////////////////////
+			/// Method update() will update a Component once for every
+			/// tick that is due. Menus update all of their Components.
+			/// @param Component& component: Component to update.
+			/// @returns unsigned int: Number of ticks run.
+			///////////////////////////////////////////////////////////
+			unsigned int update(Component& component);
+			///////////////////////////////////////////////////////////
+			/// Method reset() will drop the time that hasn't been used
+			/// by a tick and restart the timer. Call it after a pause.
+			///////////////////////////////////////////////////////////
+			void reset();
+
+			///////////////////////////////////////////////////////////
+			/// Method setTickRate() will set the number of ticks per
+			/// second.
+			/// @param unsigned int tickRate: Ticks per second.
+			///////////////////////////////////////////////////////////
+			void setTickRate(unsigned int tickRate);
+			///////////////////////////////////////////////////////////
+			/// Method setMaxTicks() will limit the ticks run in one
+			/// frame. Time beyond the limit is dropped so a slow frame
+			/// can't cause ever more ticks. By default it is 8.
+			/// @param unsigned int maxTicks: Maximum ticks per frame.
+			///////////////////////////////////////////////////////////
+			void setMaxTicks(unsigned int maxTicks);
+
+			///////////////////////////////////////////////////////////
+			/// @returns float: How far the time is between the last
+			///  tick and the next one, from 0 to 1. Blend the states
+			///  of the last two ticks by it when rendering.
+			///////////////////////////////////////////////////////////
+			float getAlpha() const;
+			///////////////////////////////////////////////////////////
+			/// @returns unsigned int: Ticks per second.
+			///////////////////////////////////////////////////////////
+			unsigned int getTickRate() const;
+			///////////////////////////////////////////////////////////
+			/// @returns float: Duration of a tick in milliseconds.
+			///////////////////////////////////////////////////////////
+			float getTickDuration() const;
+			///////////////////////////////////////////////////////////
+			/// @returns unsigned int: Maximum ticks per frame.
+			///////////////////////////////////////////////////////////
+			unsigned int getMaxTicks() const;
+			///////////////////////////////////////////////////////////
+			/// @returns size_t: Number of ticks ever run.
+			///////////////////////////////////////////////////////////
+			size_t getTickCount() const;
+		protected:
+			/// Ticks per second.
+			unsigned int tickRate;
+			/// Duration of a tick in milliseconds.
+			float tickDuration;
+			/// Maximum ticks per frame.
+			unsigned int maxTicks = 8;
+			/// Milliseconds not yet used by a tick.
+			float accumulator = 0.0f;
+			/// Number of ticks ever run.
+			size_t tickCount = 0;
+			/// Time of the last advance() call.
+			SteadyClock::time_point last;
+			/// False until advance() started the timer.
+			bool started = false;
+		};
+
+		///////////////////////////////////////////////////////////
+		/// class Interpolated holds a value that changes once per
+		/// tick and blends its last two values when rendering, so
+		/// motion looks smooth when frames and ticks don't line up.
+		/// Type needs + - and * float, or be a Color.
+		///////////////////////////////////////////////////////////
+		template <typename Type>
+		class Interpolated {
+		public:
+			Interpolated() = default;
+			///////////////////////////////////////////////////////////
+			/// @param const Type& value: Starting value.
+			///////////////////////////////////////////////////////////
+			explicit Interpolated(const Type& value);
+			~Interpolated() = default;
+
+			///////////////////////////////////////////////////////////
+			/// Method set() will store the value of the current tick.
+			/// Call it once per tick.
+			/// @param const Type& value: Value of the current tick.
+			///////////////////////////////////////////////////////////
+			void set(const Type& value);
+			///////////////////////////////////////////////////////////
+			/// Method snap() will set the value without blending from
+			/// the previous one. Use it for teleports.
+			/// @param const Type& value: New value.
+			///////////////////////////////////////////////////////////
+			void snap(const Type& value);
+
+			///////////////////////////////////////////////////////////
+			/// @param float alpha: FixedTimestep::getAlpha().
+			/// @returns Type: Value to render.
+			///////////////////////////////////////////////////////////
+			Type get(float alpha) const;
+			///////////////////////////////////////////////////////////
+			/// @returns const Type&: Value of the previous tick.
+			///////////////////////////////////////////////////////////
+			const Type& getPrevious() const;
+			///////////////////////////////////////////////////////////
+			/// @returns const Type&: Value of the current tick.
+			///////////////////////////////////////////////////////////
+			const Type& getCurrent() const;
+		protected:
+			/// Values of the last two ticks.
+			Type previous = Type(), current = Type();
+		};
+
+		///////////////////////////////////////////////////////////
+		/// FixedTimestep
+		///////////////////////////////////////////////////////////
+
+		inline FixedTimestep::FixedTimestep(unsigned int tickRate) {
+			setTickRate(tickRate);
+		}
+
+		inline unsigned int FixedTimestep::advance() {
+			const SteadyClock::time_point now = SteadyClock::now();
+			float elapsed = 0.0f;
+
+			if (started)
+				elapsed = std::chrono::duration<float, std::milli>(now - last).count();
+			last = now;
+			started = true;
+
+			return advance(elapsed);
+		}
+		inline unsigned int FixedTimestep::advance(float milliseconds) {
+			if (milliseconds > 0.0f)
+				accumulator += milliseconds;
+
+			unsigned int ticks = static_cast<unsigned int>(accumulator / tickDuration);
+			if (ticks > maxTicks) {
+				ticks = maxTicks;
+				accumulator = 0.0f;
+			}
+			else
+				accumulator -= ticks * tickDuration;
+
+			if (accumulator < 0.0f)
+				accumulator = 0.0f;
+
+			tickCount += ticks;
+			return ticks;
+		}
+		template <typename Function>
+		inline unsigned int FixedTimestep::run(Function&& tick) {
+			GLASS_PROFILE_ZONE("FixedTimestep::run");
+
+			const unsigned int ticks = advance();
+			for (unsigned int i = 0; i < ticks; i++)
+				tick();
+			return ticks;
+		}
+		inline unsigned int FixedTimestep::update(Component& component) {
+			return run([&component]() { component.update(); });
+		}
+		inline void FixedTimestep::reset() {
+			accumulator = 0.0f;
+			started = false;
+		}
+
+		inline void FixedTimestep::setTickRate(unsigned int tickRate) {
+			this->tickRate = tickRate > 0 ? tickRate : 1;
+			tickDuration = 1000.0f / this->tickRate;
+		}
+		inline void FixedTimestep::setMaxTicks(unsigned int maxTicks) {
+			this->maxTicks = maxTicks;
+		}
+
+		inline float FixedTimestep::getAlpha() const {
+			const float alpha = accumulator / tickDuration;
+			return alpha < 1.0f ? alpha : 1.0f;
+		}
+		inline unsigned int FixedTimestep::getTickRate() const {
+			return tickRate;
+		}
+		inline float FixedTimestep::getTickDuration() const {
+			return tickDuration;
+		}
+		inline unsigned int FixedTimestep::getMaxTicks() const {
+			return maxTicks;
+		}
+		inline size_t FixedTimestep::getTickCount() const {
+			return tickCount;
+		}
+
+		///////////////////////////////////////////////////////////
+		/// Interpolated
+		///////////////////////////////////////////////////////////
+
+		template <typename Type>
+		inline Interpolated<Type>::Interpolated(const Type& value)
+			: previous(value), current(value) {
+		}
+
+		template <typename Type>
+		inline void Interpolated<Type>::set(const Type& value) {
+			previous = current;
+			current = value;
+		}
+		template <typename Type>
+		inline void Interpolated<Type>::snap(const Type& value) {
+			previous = current = value;
+		}
+
+		template <typename Type>
+		inline Type Interpolated<Type>::get(float alpha) const {
+			return priv::interpolate(previous, current, alpha);
+		}
+		template <typename Type>
+		inline const Type& Interpolated<Type>::getPrevious() const {
+			return previous;
+		}
+		template <typename Type>
+		inline const Type& Interpolated<Type>::getCurrent() const {
+			return current;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,283 @@
+#pragma once
+
+// Dependencies
+#include <cmath>
+
+#include "ringBuffer.hpp"
+#include "slidingWindow.hpp"
+
+namespace gs {
+	namespace util {
+		///////////////////////////////////////////////////////////
+		/// class FrameTimeHistogram keeps statistics of the last
+		/// windowSize frame times. The frame times are counted in
+		/// logarithmic buckets, 16 per doubling from 1/64 to 2048
+		/// milliseconds, so percentiles are within about 2% of the
+		/// real value. Minimum, maximum and mean are exact. All of
+		/// the memory is allocated up front, push() never
+		/// allocates.
+		///////////////////////////////////////////////////////////
+		class FrameTimeHistogram {
+		public:
+			///////////////////////////////////////////////////////////
+			/// struct Summary holds every statistic of the window.
+			/// All times are in milliseconds.
+			///////////////////////////////////////////////////////////
+			struct Summary {
+				float min = 0.0f;
+				float mean = 0.0f;
+				float p50 = 0.0f;
+				float p95 = 0.0f;
+				float p99 = 0.0f;
+				float max = 0.0f;
+				/// Frames in the window that took longer than the budget.
+				size_t overBudget = 0;
+				/// Frames in the window.
+				size_t count = 0;
+			};
+
+			///////////////////////////////////////////////////////////
+			/// @param size_t windowSize: Number of frames kept.
+			///////////////////////////////////////////////////////////
+			explicit FrameTimeHistogram(size_t windowSize = 600);
+			~FrameTimeHistogram() = default;
+
+			///////////////////////////////////////////////////////////
+			/// Method push() will add the time of a frame. If the
+			/// window is full the oldest frame leaves it. O(1).
+			/// @param float milliseconds: Time of frame.
+			///////////////////////////////////////////////////////////
+			void push(float milliseconds);
+			///////////////////////////////////////////////////////////
+			/// Method clear() will remove all of the frames.
+			///////////////////////////////////////////////////////////
+			void clear();
+			///////////////////////////////////////////////////////////
+			/// Method setWindowSize() will change the number of frames
+			/// kept. Note: This clears the histogram.
+			/// @param size_t windowSize: Number of frames kept.
+			///////////////////////////////////////////////////////////
+			void setWindowSize(size_t windowSize);
+			///////////////////////////////////////////////////////////
+			/// Method setBudget() will set the time a frame may take
+			/// before it counts as over budget. By default it is 0
+			/// which disables counting.
+			/// @param float milliseconds: Budget of a frame.
+			///////////////////////////////////////////////////////////
+			void setBudget(float milliseconds);
+
+			///////////////////////////////////////////////////////////
+			/// Method getPercentile() will estimate the frame time
+			/// that a percentage of the frames are faster than.
+			/// O(number of buckets).
+			/// @param float percentile: From 0 to 100. Example: 99.
+			/// @returns float: Frame time in milliseconds.
+			///////////////////////////////////////////////////////////
+			float getPercentile(float percentile) const;
+			///////////////////////////////////////////////////////////
+			/// Method getSummary() will compute every statistic with
+			/// a single pass over the buckets.
+			/// @returns Summary: Statistics of the window.
+			///////////////////////////////////////////////////////////
+			Summary getSummary() const;
+
+			///////////////////////////////////////////////////////////
+			/// @returns float: Fastest frame time in the window.
+			///////////////////////////////////////////////////////////
+			float getMin() const;
+			///////////////////////////////////////////////////////////
+			/// @returns float: Slowest frame time in the window.
+			///////////////////////////////////////////////////////////
+			float getMax() const;
+			///////////////////////////////////////////////////////////
+			/// @returns float: Average frame time in the window.
+			///////////////////////////////////////////////////////////
+			float getMean() const;
+			///////////////////////////////////////////////////////////
+			/// @returns size_t: Frames in the window over budget.
+			///////////////////////////////////////////////////////////
+			size_t getOverBudgetCount() const;
+			///////////////////////////////////////////////////////////
+			/// @returns float: Budget of a frame in milliseconds.
+			///////////////////////////////////////////////////////////
+			float getBudget() const;
+			///////////////////////////////////////////////////////////
+			/// @returns size_t: Frames in the window.
+			///////////////////////////////////////////////////////////
+			size_t getCount() const;
+			///////////////////////////////////////////////////////////
+			/// @returns size_t: Maximum frames in the window.
+			///////////////////////////////////////////////////////////
+			size_t getWindowSize() const;
+		protected:
+			/// Buckets per doubling of the frame time.
+			static const int bucketsPerOctave = 16;
+			/// log2 of the smallest bucketed frame time.
+			static const int minOctave = -6;
+			/// Number of buckets, up to 2^11 milliseconds.
+			static const int bucketCount = (11 - minOctave) * bucketsPerOctave;
+
+			/// Frame times in the window.
+			RingBuffer<float> frames;
+			/// Exact minimum and maximum of the window.
+			SlidingWindowMinMax<float> extrema;
+			/// Number of frames in each bucket.
+			unsigned int buckets[bucketCount] = {};
+			/// Sum of the frame times in the window.
+			double sum = 0.0;
+			/// Budget of a frame in milliseconds.
+			float budget = 0.0f;
+			/// Frames in the window over budget.
+			size_t overBudget = 0;
+
+			///////////////////////////////////////////////////////////
+			/// @param float milliseconds: Frame time.
+			/// @returns int: Bucket the frame time is counted in.
+			///////////////////////////////////////////////////////////
+			static int bucketOf(float milliseconds);
+			///////////////////////////////////////////////////////////
+			/// @param int bucket: Index of bucket.
+			/// @returns float: Geometric middle of the bucket.
+			///////////////////////////////////////////////////////////
+			static float middleOf(int bucket);
+			///////////////////////////////////////////////////////////
+			/// @param float value: Estimate from the buckets.
+			/// @returns float: Estimate clamped to the exact extrema.
+			///////////////////////////////////////////////////////////
+			float clampToExtrema(float value) const;
+		};
+
+		///////////////////////////////////////////////////////////
+		/// FrameTimeHistogram
+		///////////////////////////////////////////////////////////
+
+		inline FrameTimeHistogram::FrameTimeHistogram(size_t windowSize) {
+			setWindowSize(windowSize);
+		}
+
+		inline void FrameTimeHistogram::push(float milliseconds) {
+			if (!(milliseconds >= 0.0f))
+				milliseconds = 0.0f;
+
+			if (frames.full()) {
+				const float oldest = frames[0];
+				buckets[bucketOf(oldest)]--;
+				sum -= oldest;
+				if (budget > 0.0f && oldest > budget)
+					overBudget--;
+			}
+
+			frames.push(milliseconds);
+			extrema.push(milliseconds);
+			buckets[bucketOf(milliseconds)]++;
+			sum += milliseconds;
+			if (budget > 0.0f && milliseconds > budget)
+				overBudget++;
+		}
+		inline void FrameTimeHistogram::clear() {
+			frames.clear();
+			extrema.clear();
+			for (unsigned int& bucket : buckets)
+				bucket = 0;
+			sum = 0.0;
+			overBudget = 0;
+		}
+		inline void FrameTimeHistogram::setWindowSize(size_t windowSize) {
+			if (windowSize == 0)
+				windowSize = 1;
+
+			frames.setCapacity(windowSize);
+			extrema.setWindowSize(windowSize);
+			clear();
+		}
+		inline void FrameTimeHistogram::setBudget(float milliseconds) {
+			budget = milliseconds;
+			overBudget = 0;
+
+			for (size_t i = 0; i < frames.size() && budget > 0.0f; i++)
+				if (frames[i] > budget)
+					overBudget++;
+		}
+
+		inline float FrameTimeHistogram::getPercentile(float percentile) const {
+			if (frames.empty())
+				return 0.0f;
+
+			// Rank of the frame, counting from 1.
+			const double rank = std::ceil(frames.size() * percentile / 100.0);
+			size_t seen = 0;
+
+			for (int i = 0; i < bucketCount; i++) {
+				seen += buckets[i];
+				if (seen >= rank && seen > 0)
+					return clampToExtrema(middleOf(i));
+			}
+			return getMax();
+		}
+		inline FrameTimeHistogram::Summary FrameTimeHistogram::getSummary() const {
+			Summary summary;
+			summary.count = frames.size();
+			summary.overBudget = overBudget;
+
+			if (frames.empty())
+				return summary;
+
+			summary.min = getMin();
+			summary.max = getMax();
+			summary.mean = getMean();
+
+			const double count = static_cast<double>(frames.size());
+			const double ranks[3] = {
+				std::ceil(count * 0.50), std::ceil(count * 0.95), std::ceil(count * 0.99)
+			};
+			float* results[3] = { &summary.p50, &summary.p95, &summary.p99 };
+			size_t seen = 0;
+			int found = 0;
+
+			for (int i = 0; i < bucketCount && found < 3; i++) {
+				seen += buckets[i];
+				while (found < 3 && seen >= ranks[found] && seen > 0)
+					*results[found++] = clampToExtrema(middleOf(i));
+			}
+			return summary;
+		}
+
+		inline float FrameTimeHistogram::getMin() const {
+			return extrema.empty() ? 0.0f : extrema.getMin();
+		}
+		inline float FrameTimeHistogram::getMax() const {
+			return extrema.empty() ? 0.0f : extrema.getMax();
+		}
+		inline float FrameTimeHistogram::getMean() const {
+			return frames.empty() ? 0.0f : static_cast<float>(sum / frames.size());
+		}
+		inline size_t FrameTimeHistogram::getOverBudgetCount() const {
+			return overBudget;
+		}
+		inline float FrameTimeHistogram::getBudget() const {
+			return budget;
+		}
+		inline size_t FrameTimeHistogram::getCount() const {
+			return frames.size();
+		}
+		inline size_t FrameTimeHistogram::getWindowSize() const {
+			return frames.capacity();
+		}
+
+		inline int FrameTimeHistogram::bucketOf(float milliseconds) {
+			if (milliseconds <= 0.0f)
+				return 0;
+
+			const int bucket = static_cast<int>(std::floor(
+				(std::log2(milliseconds) - minOctave) * bucketsPerOctave));
+			return bucket < 0 ? 0 : bucket >= bucketCount ? bucketCount - 1 : bucket;
+		}
+		inline float FrameTimeHistogram::middleOf(int bucket) {
+			return std::exp2((bucket + 0.5f) / bucketsPerOctave + minOctave);
+		}
+		inline float FrameTimeHistogram::clampToExtrema(float value) const {
+			const float min = getMin(), max = getMax();
+			return value < min ? min : value > max ? max : value;
+		}
+	}
+}
\ No newline at end of file
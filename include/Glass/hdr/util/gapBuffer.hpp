@@ -0,0 +1,219 @@
+#pragma once
+
+// Dependencies
+#include <algorithm>
+
+#include "../typedef.hpp"
+
+namespace gs {
+	namespace util {
+		///////////////////////////////////////////////////////////
+		/// class GapBuffer is a sequence with an unused gap at an
+		/// editing position. Inserting and erasing at the gap is
+		/// amortized O(1) at any size. Moving the gap costs the
+		/// distance it moves, so edits near each other stay cheap.
+		///////////////////////////////////////////////////////////
+		template <typename Type>
+		class GapBuffer {
+		public:
+			GapBuffer() = default;
+			~GapBuffer() = default;
+
+			///////////////////////////////////////////////////////////
+			/// Method insert() will add a value before the gap.
+			/// @param const Type& value: Value to add.
+			///////////////////////////////////////////////////////////
+			void insert(const Type& value);
+			///////////////////////////////////////////////////////////
+			/// Method insert() will add values before the gap.
+			/// @param const Type* values: Values to add.
+			/// @param size_t count: Number of values.
+			///////////////////////////////////////////////////////////
+			void insert(const Type* values, size_t count);
+			///////////////////////////////////////////////////////////
+			/// Method eraseBefore() will remove values before the gap.
+			/// @param size_t count: Number of values. It is clamped.
+			/// @returns size_t: Number of values removed.
+			///////////////////////////////////////////////////////////
+			size_t eraseBefore(size_t count = 1);
+			///////////////////////////////////////////////////////////
+			/// Method eraseAfter() will remove values after the gap.
+			/// @param size_t count: Number of values. It is clamped.
+			/// @returns size_t: Number of values removed.
+			///////////////////////////////////////////////////////////
+			size_t eraseAfter(size_t count = 1);
+			///////////////////////////////////////////////////////////
+			/// Method moveGap() will move the gap so it is before the
+			/// value at an index. O(distance moved).
+			/// @param size_t index: New gap index. It is clamped.
+			///////////////////////////////////////////////////////////
+			void moveGap(size_t index);
+			///////////////////////////////////////////////////////////
+			/// Method clear() will remove all of the values.
+			///////////////////////////////////////////////////////////
+			void clear();
+			///////////////////////////////////////////////////////////
+			/// Method reserve() will make room for a number of values
+			/// in total.
+			/// @param size_t capacity: Number of values.
+			///////////////////////////////////////////////////////////
+			void reserve(size_t capacity);
+
+			///////////////////////////////////////////////////////////
+			/// @param size_t index: Index skipping the gap.
+			/// @returns const Type&: Value at the index.
+			///////////////////////////////////////////////////////////
+			const Type& operator[](size_t index) const;
+			///////////////////////////////////////////////////////////
+			/// @param size_t index: Index skipping the gap.
+			/// @returns Type&: Value at the index.
+			///////////////////////////////////////////////////////////
+			Type& operator[](size_t index);
+			///////////////////////////////////////////////////////////
+			/// Method copy() will copy a range of values out.
+			/// @param size_t index: First value to copy.
+			/// @param size_t count: Number of values. It is clamped.
+			/// @param Type* output: Where to copy.
+			/// @returns size_t: Number of values copied.
+			///////////////////////////////////////////////////////////
+			size_t copy(size_t index, size_t count, Type* output) const;
+
+			///////////////////////////////////////////////////////////
+			/// @returns size_t: Number of values stored.
+			///////////////////////////////////////////////////////////
+			size_t size() const;
+			///////////////////////////////////////////////////////////
+			/// @returns size_t: Number of values before the gap.
+			///////////////////////////////////////////////////////////
+			size_t getGap() const;
+			///////////////////////////////////////////////////////////
+			/// @returns bool: True if no values are stored.
+			///////////////////////////////////////////////////////////
+			bool empty() const;
+		protected:
+			/// Values with the gap in [gapStart, gapEnd).
+			vector<Type> buffer;
+			/// First index of the gap.
+			size_t gapStart = 0;
+			/// Index after the gap.
+			size_t gapEnd = 0;
+
+			///////////////////////////////////////////////////////////
+			/// Method grow() will double the gap until it fits.
+			/// @param size_t count: Values that must fit in the gap.
+			///////////////////////////////////////////////////////////
+			void grow(size_t count);
+		};
+
+		///////////////////////////////////////////////////////////
+		/// GapBuffer
+		///////////////////////////////////////////////////////////
+
+		template <typename Type>
+		inline void GapBuffer<Type>::insert(const Type& value) {
+			if (gapStart == gapEnd)
+				grow(1);
+			buffer[gapStart++] = value;
+		}
+		template <typename Type>
+		inline void GapBuffer<Type>::insert(const Type* values, size_t count) {
+			if (gapEnd - gapStart < count)
+				grow(count);
+			std::copy(values, values + count, buffer.begin() + gapStart);
+			gapStart += count;
+		}
+		template <typename Type>
+		inline size_t GapBuffer<Type>::eraseBefore(size_t count) {
+			count = std::min(count, gapStart);
+			gapStart -= count;
+			return count;
+		}
+		template <typename Type>
+		inline size_t GapBuffer<Type>::eraseAfter(size_t count) {
+			count = std::min(count, buffer.size() - gapEnd);
+			gapEnd += count;
+			return count;
+		}
+		template <typename Type>
+		inline void GapBuffer<Type>::moveGap(size_t index) {
+			index = std::min(index, size());
+
+			if (index < gapStart) {
+				const size_t count = gapStart - index;
+				std::copy_backward(buffer.begin() + index, buffer.begin() + gapStart,
+					buffer.begin() + gapEnd);
+				gapStart -= count;
+				gapEnd -= count;
+			}
+			else if (index > gapStart) {
+				const size_t count = index - gapStart;
+				std::copy(buffer.begin() + gapEnd, buffer.begin() + gapEnd + count,
+					buffer.begin() + gapStart);
+				gapStart += count;
+				gapEnd += count;
+			}
+		}
+		template <typename Type>
+		inline void GapBuffer<Type>::clear() {
+			gapStart = 0;
+			gapEnd = buffer.size();
+		}
+		template <typename Type>
+		inline void GapBuffer<Type>::reserve(size_t capacity) {
+			if (capacity > size())
+				grow(capacity - size());
+		}
+
+		template <typename Type>
+		inline const Type& GapBuffer<Type>::operator[](size_t index) const {
+			return buffer[index < gapStart ? index : index + (gapEnd - gapStart)];
+		}
+		template <typename Type>
+		inline Type& GapBuffer<Type>::operator[](size_t index) {
+			return buffer[index < gapStart ? index : index + (gapEnd - gapStart)];
+		}
+		template <typename Type>
+		inline size_t GapBuffer<Type>::copy(size_t index, size_t count, Type* output) const {
+			index = std::min(index, size());
+			count = std::min(count, size() - index);
+
+			const size_t end = index + count;
+			if (index < gapStart) {
+				const size_t before = std::min(end, gapStart);
+				output = std::copy(buffer.begin() + index, buffer.begin() + before, output);
+				index = before;
+			}
+			if (index < end)
+				std::copy(buffer.begin() + index + (gapEnd - gapStart),
+					buffer.begin() + end + (gapEnd - gapStart), output);
+			return count;
+		}
+
+		template <typename Type>
+		inline size_t GapBuffer<Type>::size() const {
+			return buffer.size() - (gapEnd - gapStart);
+		}
+		template <typename Type>
+		inline size_t GapBuffer<Type>::getGap() const {
+			return gapStart;
+		}
+		template <typename Type>
+		inline bool GapBuffer<Type>::empty() const {
+			return size() == 0;
+		}
+
+		template <typename Type>
+		inline void GapBuffer<Type>::grow(size_t count) {
+			const size_t after = buffer.size() - gapEnd;
+			size_t capacity = std::max<size_t>(buffer.size(), 16);
+			while (capacity - size() < count)
+				capacity *= 2;
+
+			buffer.resize(capacity);
+			const size_t newGapEnd = capacity - after;
+			std::copy_backward(buffer.begin() + gapEnd, buffer.begin() + gapEnd + after,
+				buffer.end());
+			gapEnd = newGapEnd;
+		}
+	}
+}
\ No newline at end of file
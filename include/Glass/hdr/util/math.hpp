@@ -1,8 +1,25 @@
 #pragma once
 
 // Dependencies 
+#include <cmath>
+
 #include "../typedef.hpp"
 
+#if defined(GLASS_UI_API_4_EXPORTS) || defined(GLASS_DISABLE_INLINE_MATH)
+	/// Math functions are called from the Glass dll. 
+	#define GLASS_MATH_CONSTEXPR GLASS_EXPORT
+	/// Math functions are called from the Glass dll. 
+	#define GLASS_MATH_INLINE GLASS_EXPORT
+#else
+	/// Defined if the math functions are implemented in this header so
+	/// they can be inlined. The dll still exports its own copies. 
+	#define GLASS_INLINE_MATH
+	/// Used for math functions that can be evaluated at compile time. 
+	#define GLASS_MATH_CONSTEXPR constexpr
+	/// Used for math functions implemented in this header. 
+	#define GLASS_MATH_INLINE inline
+#endif
+
 ///////////////////////////////////////////////////////////
 /// Function operator*() will perform the dot product 
 /// operation on two given vectors. 
@@ -11,7 +28,7 @@
 /// @returns Type: Result of dot product. 
 ///////////////////////////////////////////////////////////
 template <typename Type>
-GLASS_EXPORT Type operator*(gs::Vec2<Type> p1, gs::Vec2<Type> p2);
+GLASS_MATH_INLINE Type operator*(gs::Vec2<Type> p1, gs::Vec2<Type> p2);
 ///////////////////////////////////////////////////////////
 /// Function operator*() will perform the dot product 
 /// operation on two given vectors. 
@@ -20,14 +37,16 @@ GLASS_EXPORT Type operator*(gs::Vec2<Type> p1, gs::Vec2<Type> p2);
 /// @returns Type: Result of dot product. 
 ///////////////////////////////////////////////////////////
 template <typename Type>
-GLASS_EXPORT Type operator*(gs::Vec3<Type> p1, gs::Vec3<Type> p2);
+GLASS_MATH_INLINE Type operator*(gs::Vec3<Type> p1, gs::Vec3<Type> p2);
 
+#ifndef GLASS_INLINE_MATH
 template GLASS_EXPORT int operator*(gs::Vec2<int>, gs::Vec2<int>);
 template GLASS_EXPORT float operator*(gs::Vec2<float>, gs::Vec2<float>);
 template GLASS_EXPORT double operator*(gs::Vec2<double>, gs::Vec2<double>);
 template GLASS_EXPORT int operator*(gs::Vec3<int>, gs::Vec3<int>);
 template GLASS_EXPORT float operator*(gs::Vec3<float>, gs::Vec3<float>);
 template GLASS_EXPORT double operator*(gs::Vec3<double>, gs::Vec3<double>);
+#endif
 
 namespace gs {
 	namespace util {
@@ -45,7 +64,7 @@ namespace gs {
 		/// @returns Type: Constrained value. 
 		///////////////////////////////////////////////////////////
 		template <typename Type>
-		GLASS_EXPORT Type clamp(Type value, Type min, Type max);
+		GLASS_MATH_CONSTEXPR Type clamp(Type value, Type min, Type max);
 		///////////////////////////////////////////////////////////
 		/// Function clamp() will constrain a value between two 
 		/// bounds. 
@@ -54,14 +73,16 @@ namespace gs {
 		/// @param Type max: Maximum bound. 
 		///////////////////////////////////////////////////////////
 		template <typename Type>
-		GLASS_EXPORT void clamp(Type* value, Type min, Type max);
+		GLASS_MATH_CONSTEXPR void clamp(Type* value, Type min, Type max);
 
+	#ifndef GLASS_INLINE_MATH
 		template GLASS_EXPORT int clamp<int>(int, int, int);
 		template GLASS_EXPORT float clamp<float>(float, float, float);
 		template GLASS_EXPORT double clamp<double>(double, double, double);
 		template GLASS_EXPORT void clamp<int>(int*, int, int);
 		template GLASS_EXPORT void clamp<float>(float*, float, float);
 		template GLASS_EXPORT void clamp<double>(double*, double, double);
+	#endif
 
 		///////////////////////////////////////////////////////////
 		/// Function distance() will perform the distance formula
@@ -71,7 +92,7 @@ namespace gs {
 		/// @returns Type: Total distance between both points. 
 		///////////////////////////////////////////////////////////
 		template <typename Type>
-		GLASS_EXPORT Type distance(Vec2<Type> p1, Vec2<Type> p2);
+		GLASS_MATH_INLINE Type distance(Vec2<Type> p1, Vec2<Type> p2);
 		///////////////////////////////////////////////////////////
 		/// Function distance() will perform the distance formula
 		/// to calculate the distance between two points given. 
@@ -80,8 +101,9 @@ namespace gs {
 		/// @returns Type: Total distance between both points. 
 		///////////////////////////////////////////////////////////
 		template <typename Type>
-		GLASS_EXPORT Type distance(Vec3<Type> p1, Vec3<Type> p2);
+		GLASS_MATH_INLINE Type distance(Vec3<Type> p1, Vec3<Type> p2);
 
+	#ifndef GLASS_INLINE_MATH
 		template GLASS_EXPORT int distance<int>(Vec2<int>, Vec2<int>);
 		template GLASS_EXPORT float distance<float>(Vec2<float>, Vec2<float>);
 		template GLASS_EXPORT double distance<double>(Vec2<double>, 
@@ -90,6 +112,39 @@ namespace gs {
 		template GLASS_EXPORT float distance<float>(Vec3<float>, Vec3<float>);
 		template GLASS_EXPORT double distance<double>(Vec3<double>, 
 			Vec3<double>);
+	#endif
+
+		///////////////////////////////////////////////////////////
+		/// Function distanceSquared() will calculate the squared
+		/// distance between two points. It skips the square root
+		/// so it is cheaper for comparing distances. 
+		/// @param Vec2<Type> p1: First point. 
+		/// @param Vec2<Type> p2: Second point. 
+		/// @returns Type: Squared distance between both points. 
+		///////////////////////////////////////////////////////////
+		template <typename Type>
+		inline Type distanceSquared(Vec2<Type> p1, Vec2<Type> p2);
+		///////////////////////////////////////////////////////////
+		/// Function distanceSquared() will calculate the squared
+		/// distance between two points. It skips the square root
+		/// so it is cheaper for comparing distances. 
+		/// @param Vec3<Type> p1: First point. 
+		/// @param Vec3<Type> p2: Second point. 
+		/// @returns Type: Squared distance between both points. 
+		///////////////////////////////////////////////////////////
+		template <typename Type>
+		inline Type distanceSquared(Vec3<Type> p1, Vec3<Type> p2);
+		///////////////////////////////////////////////////////////
+		/// Function fastDistance() will approximate the distance 
+		/// between two points without a square root. The result 
+		/// is within 4% of distance(). 
+		/// @param Vec2<Type> p1: First point. 
+		/// @param Vec2<Type> p2: Second point. 
+		/// @returns Type: Approximate distance between both 
+		///  points. 
+		///////////////////////////////////////////////////////////
+		template <typename Type>
+		inline Type fastDistance(Vec2<Type> p1, Vec2<Type> p2);
 
 		///////////////////////////////////////////////////////////
 		/// Function approach() will move a value in the direction 
@@ -101,7 +156,7 @@ namespace gs {
 		/// @returns Type: New value. 
 		///////////////////////////////////////////////////////////
 		template <typename Type>
-		GLASS_EXPORT Type approach(Type base, Type destination, 
+		GLASS_MATH_CONSTEXPR Type approach(Type base, Type destination, 
 			Type percentage);
 		///////////////////////////////////////////////////////////
 		/// Function approach() will move a color in the direction 
@@ -112,7 +167,7 @@ namespace gs {
 		///  color values. 
 		/// @returns Color: New color. 
 		///////////////////////////////////////////////////////////
-		GLASS_EXPORT Color approach(Color base, Color destination, 
+		GLASS_MATH_INLINE Color approach(Color base, Color destination, 
 			float percentage);
 		///////////////////////////////////////////////////////////
 		/// Function approach() will move a value in the direction 
@@ -125,7 +180,7 @@ namespace gs {
 		/// @returns Type: New value. 
 		///////////////////////////////////////////////////////////
 		template <typename Type>
-		GLASS_EXPORT void approach(Type* base, Type destination, 
+		GLASS_MATH_CONSTEXPR void approach(Type* base, Type destination, 
 			Type percentage); 
 		///////////////////////////////////////////////////////////
 		/// Function approach() will move a color in the direction 
@@ -137,13 +192,15 @@ namespace gs {
 		///  color values. 
 		/// @returns Color: New color. 
 		///////////////////////////////////////////////////////////
-		GLASS_EXPORT void approach(Color* base, Color destination, 
+		GLASS_MATH_INLINE void approach(Color* base, Color destination, 
 			float percentage); 
 
+	#ifndef GLASS_INLINE_MATH
 		template GLASS_EXPORT float approach<float>(float, float, float);
 		template GLASS_EXPORT double approach<double>(double, double, double);
 		template GLASS_EXPORT void approach<float>(float*, float, float);
 		template GLASS_EXPORT void approach<double>(double*, double, double);
+	#endif
 
 		///////////////////////////////////////////////////////////
 		/// Function sign() will return the value sign of a given
@@ -153,11 +210,13 @@ namespace gs {
 		///  positive. 
 		///////////////////////////////////////////////////////////
 		template <typename Type> 
-		GLASS_EXPORT Type sign(Type value); 
+		GLASS_MATH_CONSTEXPR Type sign(Type value); 
 
+	#ifndef GLASS_INLINE_MATH
 		template GLASS_EXPORT int sign(int); 
 		template GLASS_EXPORT float sign(float);
 		template GLASS_EXPORT double sign(double);
+	#endif
 
 		///////////////////////////////////////////////////////////
 		/// Function inBound() will return true if a value is 
@@ -169,12 +228,14 @@ namespace gs {
 		///  bounds. 
 		///////////////////////////////////////////////////////////
 		template <typename Type>
-		GLASS_EXPORT bool inBound(Type value, Type upperBound, Type lowerBound);
+		GLASS_MATH_CONSTEXPR bool inBound(Type value, Type upperBound, Type lowerBound);
 
+	#ifndef GLASS_INLINE_MATH
 		template GLASS_EXPORT bool inBound(int, int, int); 
 		template GLASS_EXPORT bool inBound(unsigned, unsigned, unsigned);
 		template GLASS_EXPORT bool inBound(float, float, float);
 		template GLASS_EXPORT bool inBound(double, double, double);
+	#endif
 
 		///////////////////////////////////////////////////////////
 		/// Function mod() performs the modulus operation on a 
@@ -185,11 +246,13 @@ namespace gs {
 		/// @returns Type: Remainder after performing modulus. 
 		///////////////////////////////////////////////////////////
 		template <typename Type>
-		GLASS_EXPORT Type mod(Type value, Type divisor);
+		GLASS_MATH_INLINE Type mod(Type value, Type divisor);
 
+	#ifndef GLASS_INLINE_MATH
 		template GLASS_EXPORT int mod(int, int);
 		template GLASS_EXPORT float mod(float, float);
 		template GLASS_EXPORT double mod(double, double); 
+	#endif
 
 		///////////////////////////////////////////////////////////
 		/// Function toDegrees() will convert a radian value to 
@@ -198,10 +261,12 @@ namespace gs {
 		/// @returns Type: Degrees. 
 		///////////////////////////////////////////////////////////
 		template <typename Type>
-		GLASS_EXPORT Type toDegrees(Type radians);
+		GLASS_MATH_CONSTEXPR Type toDegrees(Type radians);
 
+	#ifndef GLASS_INLINE_MATH
 		template GLASS_EXPORT float toDegrees<float>(float);
 		template GLASS_EXPORT double toDegrees<double>(double);
+	#endif
 
 		///////////////////////////////////////////////////////////
 		/// Function toRadians() will convert a degree value to 
@@ -210,10 +275,12 @@ namespace gs {
 		/// @returns Type: Radians. 
 		///////////////////////////////////////////////////////////
 		template <typename Type>
-		GLASS_EXPORT Type toRadians(Type degrees);
+		GLASS_MATH_CONSTEXPR Type toRadians(Type degrees);
 
+	#ifndef GLASS_INLINE_MATH
 		template GLASS_EXPORT float toRadians<float>(float);
 		template GLASS_EXPORT double toRadians<double>(double);
+	#endif
 
 		///////////////////////////////////////////////////////////
 		/// Function angleBetween() will get the angle between two
@@ -222,14 +289,38 @@ namespace gs {
 		/// @param Vec2<Type> p2: Second point. 
 		/// @param bool inDegrees: True if output angle is needed
 		///  in degrees, false for radians. 
-		/// @returns Type: Angle of two points given. 
+		/// @returns Type: Angle of two points given from 0 to 360
+		///  degrees or 0 to 2 pi radians. 
 		///////////////////////////////////////////////////////////
 		template <typename Type>
-		GLASS_EXPORT Type angleBetween(
+		GLASS_MATH_INLINE Type angleBetween(
 			Vec2<Type> p1, Vec2<Type> p2, bool inDegrees = true);
 
+	#ifndef GLASS_INLINE_MATH
 		template GLASS_EXPORT float angleBetween(Vec2<float>, Vec2<float>, bool);
 		template GLASS_EXPORT double angleBetween(Vec2<double>, Vec2<double>, bool);
+	#endif
+
+		///////////////////////////////////////////////////////////
+		/// Function fastAtan2() will approximate atan2 with a
+		/// polynomial. The result is within 0.0003 radians. 
+		/// @param float y: Y component. 
+		/// @param float x: X component. 
+		/// @returns float: Angle in radians from -pi to pi. 
+		///////////////////////////////////////////////////////////
+		inline float fastAtan2(float y, float x);
+		///////////////////////////////////////////////////////////
+		/// Function fastAngleBetween() will get the angle between
+		/// two points like angleBetween() using fastAtan2(). 
+		/// @param Vec2f p1: First point. 
+		/// @param Vec2f p2: Second point. 
+		/// @param bool inDegrees: True if output angle is needed
+		///  in degrees, false for radians. 
+		/// @returns float: Approximate angle of two points given
+		///  from 0 to 360 degrees or 0 to 2 pi radians. 
+		///////////////////////////////////////////////////////////
+		inline float fastAngleBetween(
+			Vec2f p1, Vec2f p2, bool inDegrees = true);
 
 		///////////////////////////////////////////////////////////
 		/// Function polarToCartesian() will convert a given polar
@@ -242,11 +333,13 @@ namespace gs {
 		///  coordinate given. 
 		///////////////////////////////////////////////////////////
 		template <typename Type>
-		GLASS_EXPORT Vec2<Type> polarToCartesian(
+		GLASS_MATH_INLINE Vec2<Type> polarToCartesian(
 			Vec2<Type> polarCoordinate, bool inDegrees = true); 
 
+	#ifndef GLASS_INLINE_MATH
 		template GLASS_EXPORT Vec2<float> polarToCartesian(Vec2<float>, bool);
 		template GLASS_EXPORT Vec2<double> polarToCartesian(Vec2<double>, bool);
+	#endif
 
 		///////////////////////////////////////////////////////////
 		/// Function cartesianToPolar() will convert a given 2d
@@ -259,10 +352,189 @@ namespace gs {
 		///  coordinate given. 
 		///////////////////////////////////////////////////////////
 		template <typename Type>
-		GLASS_EXPORT Vec2<Type> cartesianToPolar(
+		GLASS_MATH_INLINE Vec2<Type> cartesianToPolar(
 			Vec2<Type> cartesianCoordinate, bool inDegrees = true); 
 
+	#ifndef GLASS_INLINE_MATH
 		template GLASS_EXPORT Vec2<float> cartesianToPolar(Vec2<float>, bool); 
 		template GLASS_EXPORT Vec2<double> cartesianToPolar(Vec2<double>, bool); 
+	#endif
+
+		///////////////////////////////////////////////////////////
+		/// distanceSquared
+		///////////////////////////////////////////////////////////
+
+		template <typename Type>
+		inline Type distanceSquared(Vec2<Type> p1, Vec2<Type> p2) {
+			return (p2.x - p1.x) * (p2.x - p1.x) + (p2.y - p1.y) * (p2.y - p1.y);
+		}
+		template <typename Type>
+		inline Type distanceSquared(Vec3<Type> p1, Vec3<Type> p2) {
+			return (p2.x - p1.x) * (p2.x - p1.x) + (p2.y - p1.y) * (p2.y - p1.y)
+				+ (p2.z - p1.z) * (p2.z - p1.z);
+		}
+		template <typename Type>
+		inline Type fastDistance(Vec2<Type> p1, Vec2<Type> p2) {
+			// Alpha max plus beta min. 
+			const Type x = p2.x > p1.x ? p2.x - p1.x : p1.x - p2.x;
+			const Type y = p2.y > p1.y ? p2.y - p1.y : p1.y - p2.y;
+			const Type high = x > y ? x : y, low = x > y ? y : x;
+			return static_cast<Type>(0.96043387 * high + 0.39782473 * low);
+		}
+
+		///////////////////////////////////////////////////////////
+		/// fastAtan2
+		///////////////////////////////////////////////////////////
+
+		inline float fastAtan2(float y, float x) {
+			const float ax = std::fabs(x), ay = std::fabs(y);
+			if (ax == 0.0f && ay == 0.0f)
+				return 0.0f;
+
+			const float a = ax > ay ? ay / ax : ax / ay;
+			const float s = a * a;
+			float angle = ((-0.0464964749f * s + 0.15931422f) * s - 0.327622764f) * s * a + a;
+
+			if (ay > ax)
+				angle = 1.57079637f - angle;
+			if (x < 0.0f)
+				angle = 3.14159274f - angle;
+			return y < 0.0f ? -angle : angle;
+		}
+		inline float fastAngleBetween(Vec2f p1, Vec2f p2, bool inDegrees) {
+			float angle = fastAtan2(p2.y - p1.y, p2.x - p1.x);
+			if (angle < 0.0f)
+				angle += 6.28318531f;
+			return inDegrees ? angle * (180.0f / 3.14159265f) : angle;
+		}
+
+	#ifdef GLASS_INLINE_MATH
+		///////////////////////////////////////////////////////////
+		/// clamp
+		///////////////////////////////////////////////////////////
+
+		template <typename Type>
+		constexpr Type clamp(Type value, Type min, Type max) {
+			return value < min ? min : max < value ? max : value;
+		}
+		template <typename Type>
+		constexpr void clamp(Type* value, Type min, Type max) {
+			*value = clamp(*value, min, max);
+		}
+
+		///////////////////////////////////////////////////////////
+		/// distance
+		///////////////////////////////////////////////////////////
+
+		template <typename Type>
+		inline Type distance(Vec2<Type> p1, Vec2<Type> p2) {
+			return static_cast<Type>(std::sqrt(distanceSquared(p1, p2)));
+		}
+		template <typename Type>
+		inline Type distance(Vec3<Type> p1, Vec3<Type> p2) {
+			return static_cast<Type>(std::sqrt(distanceSquared(p1, p2)));
+		}
+
+		///////////////////////////////////////////////////////////
+		/// approach
+		///////////////////////////////////////////////////////////
+
+		template <typename Type>
+		constexpr Type approach(Type base, Type destination, Type percentage) {
+			return base + (destination - base) * (percentage / static_cast<Type>(100));
+		}
+		inline Color approach(Color base, Color destination, float percentage) {
+			const float factor = percentage / 100.0f;
+			auto channel = [factor](sf::Uint8 value, sf::Uint8 target) {
+				return static_cast<sf::Uint8>(static_cast<int>(static_cast<float>(value)
+					+ (static_cast<float>(target) - static_cast<float>(value)) * factor));
+			};
+			return Color(channel(base.r, destination.r), channel(base.g, destination.g),
+				channel(base.b, destination.b), channel(base.a, destination.a));
+		}
+		template <typename Type>
+		constexpr void approach(Type* base, Type destination, Type percentage) {
+			*base = approach(*base, destination, percentage);
+		}
+		inline void approach(Color* base, Color destination, float percentage) {
+			*base = approach(*base, destination, percentage);
+		}
+
+		///////////////////////////////////////////////////////////
+		/// sign
+		///////////////////////////////////////////////////////////
+
+		template <typename Type>
+		constexpr Type sign(Type value) {
+			return static_cast<Type>((static_cast<Type>(0) < value) - (value < static_cast<Type>(0)));
+		}
+		template <typename Type>
+		constexpr bool inBound(Type value, Type upperBound, Type lowerBound) {
+			return value >= lowerBound && value <= upperBound;
+		}
+
+		///////////////////////////////////////////////////////////
+		/// mod
+		///////////////////////////////////////////////////////////
+
+		template <typename Type>
+		inline Type mod(Type value, Type divisor) {
+			const Type remainder = static_cast<Type>(std::fmod(value, divisor));
+			return remainder < static_cast<Type>(0) ? remainder + divisor : remainder;
+		}
+		template <>
+		inline int mod<int>(int value, int divisor) {
+			const int remainder = value % divisor;
+			return remainder < 0 ? remainder + divisor : remainder;
+		}
+
+		///////////////////////////////////////////////////////////
+		/// Angles
+		///////////////////////////////////////////////////////////
+
+		template <typename Type>
+		constexpr Type toDegrees(Type radians) {
+			return radians * static_cast<Type>(180.0 / 3.14159265358979323846);
+		}
+		template <typename Type>
+		constexpr Type toRadians(Type degrees) {
+			return degrees * static_cast<Type>(3.14159265358979323846 / 180.0);
+		}
+		template <typename Type>
+		inline Type angleBetween(Vec2<Type> p1, Vec2<Type> p2, bool inDegrees) {
+			Type angle = static_cast<Type>(std::atan2(
+				static_cast<double>(p2.y - p1.y), static_cast<double>(p2.x - p1.x)));
+			if (angle < static_cast<Type>(0))
+				angle += static_cast<Type>(2.0 * 3.14159265358979323846);
+			return inDegrees ? toDegrees(angle) : angle;
+		}
+		template <typename Type>
+		inline Vec2<Type> polarToCartesian(Vec2<Type> polarCoordinate, bool inDegrees) {
+			const Type angle = inDegrees ? toRadians(polarCoordinate.y) : polarCoordinate.y;
+			return Vec2<Type>(polarCoordinate.x * std::cos(angle),
+				polarCoordinate.x * std::sin(angle));
+		}
+		template <typename Type>
+		inline Vec2<Type> cartesianToPolar(Vec2<Type> cartesianCoordinate, bool inDegrees) {
+			return Vec2<Type>(
+				std::sqrt(distanceSquared(Vec2<Type>(), cartesianCoordinate)),
+				angleBetween(Vec2<Type>(), cartesianCoordinate, inDegrees));
+		}
+	#endif
 	}
-}
\ No newline at end of file
+}
+
+#ifdef GLASS_INLINE_MATH
+///////////////////////////////////////////////////////////
+/// operator*
+///////////////////////////////////////////////////////////
+
+template <typename Type>
+inline Type operator*(gs::Vec2<Type> p1, gs::Vec2<Type> p2) {
+	return p1.x * p2.x + p1.y * p2.y;
+}
+template <typename Type>
+inline Type operator*(gs::Vec3<Type> p1, gs::Vec3<Type> p2) {
+	return p1.x * p2.x + p1.y * p2.y + p1.z * p2.z;
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,218 @@
+#pragma once
+
+// Dependencies
+#include <limits>
+
+#include "ringBuffer.hpp"
+
+namespace gs {
+	namespace util {
+		///////////////////////////////////////////////////////////
+		/// class MinMaxPyramid is a multi resolution summary of a
+		/// RingBuffer of values. Level l stores the minimum and
+		/// maximum of every aligned block of 2^(l + 1) values, so
+		/// the extrema of any range can be found from O(log n)
+		/// blocks instead of every value in the range. It is fed
+		/// the same values as the RingBuffer it summarizes.
+		///////////////////////////////////////////////////////////
+		class MinMaxPyramid {
+		public:
+			///////////////////////////////////////////////////////////
+			/// struct Extrema is the minimum and maximum of a range of
+			/// values. The indices are push counts, convert them with
+			/// toIndex(). NaN values are ignored, a range of only NaN
+			/// has min greater than max.
+			///////////////////////////////////////////////////////////
+			struct Extrema {
+				float min = std::numeric_limits<float>::infinity();
+				float max = -std::numeric_limits<float>::infinity();
+				size_t minIndex = 0;
+				size_t maxIndex = 0;
+			};
+
+			MinMaxPyramid() = default;
+			///////////////////////////////////////////////////////////
+			/// @param size_t capacity: Capacity of the summarized
+			///  RingBuffer.
+			///////////////////////////////////////////////////////////
+			explicit MinMaxPyramid(size_t capacity);
+			~MinMaxPyramid() = default;
+
+			///////////////////////////////////////////////////////////
+			/// Method push() will add a value. Amortized O(1).
+			/// @param float value: Value that was pushed to the
+			///  summarized RingBuffer.
+			///////////////////////////////////////////////////////////
+			void push(float value);
+			///////////////////////////////////////////////////////////
+			/// Method clear() will remove all of the values.
+			///////////////////////////////////////////////////////////
+			void clear();
+			///////////////////////////////////////////////////////////
+			/// Method setCapacity() will resize the levels to match
+			/// a RingBuffer capacity. Note: This clears the pyramid,
+			/// push the kept values again to restore it.
+			/// @param size_t capacity: Capacity of the summarized
+			///  RingBuffer.
+			///////////////////////////////////////////////////////////
+			void setCapacity(size_t capacity);
+
+			///////////////////////////////////////////////////////////
+			/// Method query() will find the extrema of a range.
+			/// @param const RingBuffer<float>& values: The summarized
+			///  RingBuffer.
+			/// @param size_t first: Index of first value in values.
+			/// @param size_t last: Index after last value in values.
+			/// @returns Extrema: Extrema of the range.
+			///////////////////////////////////////////////////////////
+			Extrema query(
+				const RingBuffer<float>& values,
+				size_t first, size_t last
+			) const;
+			///////////////////////////////////////////////////////////
+			/// @param const RingBuffer<float>& values: The summarized
+			///  RingBuffer.
+			/// @param size_t pushIndex: Index from an Extrema.
+			/// @returns size_t: Index in values.
+			///////////////////////////////////////////////////////////
+			size_t toIndex(const RingBuffer<float>& values, size_t pushIndex) const;
+		protected:
+			/// Block extrema. levels[l] has blocks of 2^(l + 1) values.
+			vector<RingBuffer<Extrema>> levels;
+			/// Extrema of the last value if it starts a level 0 block.
+			Extrema pendingLeaf;
+			/// Number of values ever pushed.
+			size_t pushCount = 0;
+
+			///////////////////////////////////////////////////////////
+			/// @param float value: Value to summarize.
+			/// @param size_t pushIndex: Push count of value.
+			/// @returns Extrema: Extrema of the single value.
+			///////////////////////////////////////////////////////////
+			static Extrema leaf(float value, size_t pushIndex);
+			///////////////////////////////////////////////////////////
+			/// @param const Extrema& a: First extrema.
+			/// @param const Extrema& b: Second extrema.
+			/// @returns Extrema: Extrema of both.
+			///////////////////////////////////////////////////////////
+			static Extrema combine(const Extrema& a, const Extrema& b);
+		};
+
+		///////////////////////////////////////////////////////////
+		/// MinMaxPyramid
+		///////////////////////////////////////////////////////////
+
+		inline MinMaxPyramid::MinMaxPyramid(size_t capacity) {
+			setCapacity(capacity);
+		}
+
+		inline void MinMaxPyramid::push(float value) {
+			const size_t index = pushCount++;
+			const Extrema current = leaf(value, index);
+
+			if (levels.empty())
+				return;
+			if ((index & 1) == 0) {
+				pendingLeaf = current;
+				return;
+			}
+
+			levels[0].push(combine(pendingLeaf, current));
+
+			// Every completed block completes a block above it on
+			// every level its size divides.
+			for (size_t level = 1; level < levels.size(); level++) {
+				if ((pushCount & ((size_t(2) << level) - 1)) != 0)
+					break;
+
+				const RingBuffer<Extrema>& below = levels[level - 1];
+				levels[level].push(combine(
+					below[below.size() - 2],
+					below[below.size() - 1]
+				));
+			}
+		}
+		inline void MinMaxPyramid::clear() {
+			for (RingBuffer<Extrema>& level : levels)
+				level.clear();
+			pushCount = 0;
+		}
+		inline void MinMaxPyramid::setCapacity(size_t capacity) {
+			levels.clear();
+
+			// A range of capacity values touches at most capacity /
+			// blockSize + 1 blocks of a level.
+			for (size_t blockSize = 2; blockSize <= capacity; blockSize *= 2)
+				levels.emplace_back(capacity / blockSize + 2);
+
+			pushCount = 0;
+		}
+
+		inline MinMaxPyramid::Extrema MinMaxPyramid::query(
+			const RingBuffer<float>& values,
+			size_t first, size_t last
+		) const {
+			Extrema result;
+			const size_t offset = pushCount - values.size();
+			size_t begin = first + offset;
+			const size_t end = last + offset;
+
+			while (begin < end) {
+				bool found = false;
+
+				// Take the largest stored block starting at begin.
+				for (size_t level = levels.size(); level-- > 0 && !found;) {
+					const size_t blockSize = size_t(2) << level;
+					if ((begin & (blockSize - 1)) != 0 || begin + blockSize > end)
+						continue;
+
+					const RingBuffer<Extrema>& blocks = levels[level];
+					const size_t block = begin / blockSize;
+					const size_t newest = pushCount / blockSize;
+					if (block >= newest || newest - block > blocks.size())
+						continue;
+
+					result = combine(result, blocks[blocks.size() - (newest - block)]);
+					begin += blockSize;
+					found = true;
+				}
+
+				if (!found) {
+					result = combine(result, leaf(values[begin - offset], begin));
+					begin++;
+				}
+			}
+			return result;
+		}
+		inline size_t MinMaxPyramid::toIndex(
+			const RingBuffer<float>& values,
+			size_t pushIndex
+		) const {
+			return pushIndex - (pushCount - values.size());
+		}
+
+		inline MinMaxPyramid::Extrema MinMaxPyramid::leaf(float value, size_t pushIndex) {
+			Extrema result;
+			if (value == value) {
+				result.min = result.max = value;
+				result.minIndex = result.maxIndex = pushIndex;
+			}
+			return result;
+		}
+		inline MinMaxPyramid::Extrema MinMaxPyramid::combine(
+			const Extrema& a,
+			const Extrema& b
+		) {
+			Extrema result = a;
+			if (b.min < result.min) {
+				result.min = b.min;
+				result.minIndex = b.minIndex;
+			}
+			if (b.max > result.max) {
+				result.max = b.max;
+				result.maxIndex = b.maxIndex;
+			}
+			return result;
+		}
+	}
+}
\ No newline at end of file
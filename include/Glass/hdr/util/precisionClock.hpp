@@ -0,0 +1,332 @@
+#pragma once
+
+// Dependencies
+#include <algorithm>
+#include <thread>
+
+#include "clock.hpp"
+#include "frameTimeHistogram.hpp"
+#include "profiler.hpp"
+
+namespace gs {
+	namespace util {
+		///////////////////////////////////////////////////////////
+		/// class PrecisionClock is a Clock that paces frames to
+		/// absolute deadlines on a steady clock. Every deadline is
+		/// one frame after the last one instead of one frame after
+		/// end(), so the frame rate doesn't drift. wait() sleeps
+		/// until shortly before the deadline and then yields in a
+		/// loop for the rest, because the OS often wakes a sleeping
+		/// thread a millisecond or more late. It is used the same
+		/// way as Clock. The last frame times are kept in
+		/// histograms for percentiles and stutter detection.
+		///////////////////////////////////////////////////////////
+		class PrecisionClock : public Clock {
+		public:
+			/// Alias for std::chrono::steady_clock.
+			typedef std::chrono::steady_clock SteadyClock;
+
+			PrecisionClock() = default;
+			~PrecisionClock() = default;
+
+			///////////////////////////////////////////////////////////
+			/// Method begin() will start the Clock. Note: To stop the
+			/// clock call end() and then call wait() to wait until a
+			/// certain framerate has been achieved.
+			///////////////////////////////////////////////////////////
+			virtual void begin() override;
+			///////////////////////////////////////////////////////////
+			/// Method end() will stop the Clock. Note: Call wait()
+			/// afterwards to wait until a certain framerate has been
+			/// achieved.
+			///////////////////////////////////////////////////////////
+			virtual void end() override;
+			///////////////////////////////////////////////////////////
+			/// Method wait() will wait on the current thread until the
+			/// next frame deadline. If a frame took so long that a
+			/// whole frame was missed the deadlines start over instead
+			/// of rushing the following frames. A framerate of 0
+			/// doesn't wait.
+			/// @param unsigned int framerate: Target frames per second.
+			///////////////////////////////////////////////////////////
+			virtual void wait(unsigned int framerate) override;
+
+			///////////////////////////////////////////////////////////
+			/// Method setSpinThreshold() will set how long before a
+			/// deadline wait() stops sleeping and starts yielding.
+			/// Larger values are more precise but use more CPU. By
+			/// default it is 1.5 milliseconds.
+			/// @param float milliseconds: Time spent yielding.
+			///////////////////////////////////////////////////////////
+			virtual void setSpinThreshold(float milliseconds);
+			///////////////////////////////////////////////////////////
+			/// Method resetPacingError() will reset the average and
+			/// maximum pacing errors.
+			///////////////////////////////////////////////////////////
+			virtual void resetPacingError();
+			///////////////////////////////////////////////////////////
+			/// Method setIdle() will enable or disable idle mode. While
+			/// idle wait() paces to the idle framerate instead, which
+			/// lets a static UI use almost no CPU. Idle frames and the
+			/// first frame after leaving idle mode aren't added to the
+			/// histograms. Example:
+			/// clock.setIdle(redrawTracker.isIdle()).
+			/// @param bool idle: True to enter idle mode.
+			///////////////////////////////////////////////////////////
+			virtual void setIdle(bool idle);
+			///////////////////////////////////////////////////////////
+			/// Method setIdleFramerate() will set the framerate used
+			/// in idle mode. Input is only noticed once per idle frame
+			/// so lower values add latency. By default it is 20.
+			/// @param unsigned int framerate: Idle frames per second.
+			///////////////////////////////////////////////////////////
+			virtual void setIdleFramerate(unsigned int framerate);
+
+			///////////////////////////////////////////////////////////
+			/// @returns float: Frame rate after last wait() call.
+			///////////////////////////////////////////////////////////
+			virtual float getFrameRate() const override;
+			///////////////////////////////////////////////////////////
+			/// @returns float: Frame rate if uncapped from last wait()
+			///  call.
+			///////////////////////////////////////////////////////////
+			virtual float getUncappedFrameRate() const override;
+			///////////////////////////////////////////////////////////
+			/// @returns float: Time spent yielding before a deadline.
+			///////////////////////////////////////////////////////////
+			virtual float getSpinThreshold() const;
+			///////////////////////////////////////////////////////////
+			/// @returns float: Milliseconds the last wait() returned
+			///  after its deadline.
+			///////////////////////////////////////////////////////////
+			virtual float getPacingError() const;
+			///////////////////////////////////////////////////////////
+			/// @returns float: Average pacing error in milliseconds
+			///  since the last resetPacingError() call.
+			///////////////////////////////////////////////////////////
+			virtual float getAveragePacingError() const;
+			///////////////////////////////////////////////////////////
+			/// @returns float: Largest pacing error in milliseconds
+			///  since the last resetPacingError() call.
+			///////////////////////////////////////////////////////////
+			virtual float getMaxPacingError() const;
+			///////////////////////////////////////////////////////////
+			/// @returns bool: True if in idle mode.
+			///////////////////////////////////////////////////////////
+			virtual bool isIdle() const;
+			///////////////////////////////////////////////////////////
+			/// @returns unsigned int: Framerate used in idle mode.
+			///////////////////////////////////////////////////////////
+			virtual unsigned int getIdleFramerate() const;
+			///////////////////////////////////////////////////////////
+			/// Method getFrameTimes() will return the histogram of the
+			/// time between wait() calls. When the framerate given to
+			/// wait() changes its budget is set to 1.5 frames, so
+			/// over budget frames are dropped frames. Call setBudget()
+			/// on it to change that.
+			/// @returns FrameTimeHistogram&: Frame time histogram.
+			///////////////////////////////////////////////////////////
+			virtual FrameTimeHistogram& getFrameTimes();
+			///////////////////////////////////////////////////////////
+			/// Method getWorkTimes() will return the histogram of the
+			/// time between begin() and end(). When the framerate
+			/// given to wait() changes its budget is set to 1 frame.
+			/// @returns FrameTimeHistogram&: Work time histogram.
+			///////////////////////////////////////////////////////////
+			virtual FrameTimeHistogram& getWorkTimes();
+		protected:
+			/// Start and end of the work of the current frame.
+			SteadyClock::time_point workStart, workEnd;
+			/// Time the last wait() returned.
+			SteadyClock::time_point lastWake;
+			/// Deadline of the last paced frame.
+			SteadyClock::time_point deadline;
+			/// Framerate the deadlines were scheduled for, 0 if none.
+			unsigned int pacedFramerate = 0;
+			/// Framerate last passed to wait(), before idle mode.
+			unsigned int requestedFramerate = 0;
+			/// Time spent yielding before a deadline.
+			SteadyClock::duration spinThreshold = std::chrono::microseconds(1500);
+			/// Pacing errors in milliseconds.
+			float pacingError = 0.0f, pacingErrorSum = 0.0f, maxPacingError = 0.0f;
+			/// Number of frames in pacingErrorSum.
+			size_t pacedFrames = 0;
+			/// True after the first wait() call.
+			bool hasWoken = false;
+			/// True in idle mode.
+			bool idle = false;
+			/// True if the last wait() was in idle mode.
+			bool wokeIdle = false;
+			/// Framerate used in idle mode.
+			unsigned int idleFramerate = 20;
+			/// Time between wait() calls.
+			FrameTimeHistogram frameTimes;
+			/// Time between begin() and end().
+			FrameTimeHistogram workTimes;
+
+			///////////////////////////////////////////////////////////
+			/// Method sleepUntil() will sleep and then yield until a
+			/// point in time.
+			/// @param SteadyClock::time_point time: Time to wake up.
+			///////////////////////////////////////////////////////////
+			virtual void sleepUntil(SteadyClock::time_point time);
+			///////////////////////////////////////////////////////////
+			/// Method onFrame() is called at the end of every wait()
+			/// call with the measured times.
+			/// @param float frameTime: Milliseconds since the last
+			///  wait() returned.
+			/// @param float workTime: Milliseconds between begin() and
+			///  end().
+			///////////////////////////////////////////////////////////
+			virtual void onFrame(float frameTime, float workTime);
+		};
+
+		///////////////////////////////////////////////////////////
+		/// PrecisionClock
+		///////////////////////////////////////////////////////////
+
+		inline void PrecisionClock::begin() {
+			workStart = SteadyClock::now();
+		}
+		inline void PrecisionClock::end() {
+			workEnd = SteadyClock::now();
+		}
+		inline void PrecisionClock::wait(unsigned int framerate) {
+			GLASS_PROFILE_ZONE("Clock::wait");
+
+			difference = workEnd - workStart;
+			const float workTime = difference.count();
+
+			// Budgets follow the caller's framerate so entering and
+			// leaving idle mode keeps them, and any setBudget() call.
+			const bool requestChanged = framerate != requestedFramerate;
+			requestedFramerate = framerate;
+
+			if (requestChanged && framerate != 0) {
+				frameTimes.setBudget(framesToMilliseconds(framerate) * 1.5f);
+				workTimes.setBudget(framesToMilliseconds(framerate));
+			}
+
+			if (idle && idleFramerate != 0 && (framerate == 0 || idleFramerate < framerate))
+				framerate = idleFramerate;
+
+			if (framerate != 0) {
+				const SteadyClock::duration period =
+					std::chrono::duration_cast<SteadyClock::duration>(
+						std::chrono::duration<double>(1.0 / framerate));
+				const SteadyClock::time_point now = SteadyClock::now();
+
+				// Idle mode only changes the period, the deadlines carry
+				// on from the last one.
+				if (requestChanged || pacedFramerate == 0)
+					deadline = workStart + period;
+				else
+					deadline += period;
+
+				// A missed frame is dropped instead of caught up on.
+				if (now > deadline + period)
+					deadline = now;
+
+				pacedFramerate = framerate;
+				sleepUntil(deadline);
+			}
+			else
+				pacedFramerate = 0;
+
+			const SteadyClock::time_point wake = SteadyClock::now();
+
+			if (framerate != 0) {
+				pacingError = Duration(wake - deadline).count();
+				pacingErrorSum += pacingError;
+				maxPacingError = std::max(maxPacingError, pacingError);
+				pacedFrames++;
+			}
+
+			const float frameTime = hasWoken
+				? Duration(wake - lastWake).count()
+				: Duration(wake - workStart).count();
+			lastWake = wake;
+			hasWoken = true;
+
+			// The first frame after idle mode spans an idle frame.
+			if (!idle && !wokeIdle) {
+				frameTimes.push(frameTime);
+				workTimes.push(workTime);
+			}
+			wokeIdle = idle;
+
+			currentFrameRate = frameTime > 0.0f ? millisecondsToFrames(frameTime) : 0.0f;
+			currentUncappedFrameRate = workTime > 0.0f ? millisecondsToFrames(workTime) : 0.0f;
+			onFrame(frameTime, workTime);
+		}
+
+		inline void PrecisionClock::setSpinThreshold(float milliseconds) {
+			spinThreshold = std::chrono::duration_cast<SteadyClock::duration>(
+				Duration(std::max(milliseconds, 0.0f)));
+		}
+		inline void PrecisionClock::resetPacingError() {
+			pacingErrorSum = 0.0f;
+			maxPacingError = 0.0f;
+			pacedFrames = 0;
+		}
+
+		inline void PrecisionClock::setIdle(bool idle) {
+			this->idle = idle;
+		}
+		inline void PrecisionClock::setIdleFramerate(unsigned int framerate) {
+			idleFramerate = framerate;
+		}
+
+		inline float PrecisionClock::getFrameRate() const {
+			return currentFrameRate;
+		}
+		inline float PrecisionClock::getUncappedFrameRate() const {
+			return currentUncappedFrameRate;
+		}
+		inline float PrecisionClock::getSpinThreshold() const {
+			return Duration(spinThreshold).count();
+		}
+		inline float PrecisionClock::getPacingError() const {
+			return pacingError;
+		}
+		inline float PrecisionClock::getAveragePacingError() const {
+			return pacedFrames > 0 ? pacingErrorSum / pacedFrames : 0.0f;
+		}
+		inline float PrecisionClock::getMaxPacingError() const {
+			return maxPacingError;
+		}
+
+		inline bool PrecisionClock::isIdle() const {
+			return idle;
+		}
+		inline unsigned int PrecisionClock::getIdleFramerate() const {
+			return idleFramerate;
+		}
+		inline FrameTimeHistogram& PrecisionClock::getFrameTimes() {
+			return frameTimes;
+		}
+		inline FrameTimeHistogram& PrecisionClock::getWorkTimes() {
+			return workTimes;
+		}
+
+		inline void PrecisionClock::sleepUntil(SteadyClock::time_point time) {
+			SteadyClock::time_point now = SteadyClock::now();
+
+			// Sleeping can overshoot, so only sleep while the rest of
+			// the wait is longer than the spin threshold. sf::sleep()
+			// like Clock::wait() because it raises the timer resolution
+			// on Windows, where std::this_thread::sleep_for() can wake
+			// up to a scheduler tick late.
+			while (time - now > spinThreshold) {
+				const auto sleep = std::chrono::duration_cast<std::chrono::microseconds>(
+					time - now - spinThreshold);
+				sf::sleep(sf::microseconds(static_cast<sf::Int64>(sleep.count())));
+				now = SteadyClock::now();
+			}
+			while (SteadyClock::now() < time)
+				std::this_thread::yield();
+		}
+		inline void PrecisionClock::onFrame(float, float) {
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,446 @@
+#pragma once
+
+// Dependencies
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+
+#include "../typedef.hpp"
+
+#ifndef GLASS_DISABLE_PROFILER
+	/// Used to join two tokens after expanding them.
+	#define GLASS_PROFILE_CONCAT_INNER(a, b) a##b
+	/// Used to join two tokens after expanding them.
+	#define GLASS_PROFILE_CONCAT(a, b) GLASS_PROFILE_CONCAT_INNER(a, b)
+	/// Times the rest of the current scope as a zone. The name must
+	/// be a string literal or otherwise outlive the Profiler.
+	#define GLASS_PROFILE_ZONE(name) ::gs::util::ProfileZone \
+		GLASS_PROFILE_CONCAT(glassProfileZone, __LINE__)(name)
+	/// Times the rest of the current scope as a zone named after the
+	/// dynamic type of a Component, such as "class gs::Button".
+	#define GLASS_PROFILE_COMPONENT(component) \
+		GLASS_PROFILE_ZONE(typeid(component).name())
+#else
+	/// Times the rest of the current scope as a zone. Compiled out
+	/// because GLASS_DISABLE_PROFILER is defined.
+	#define GLASS_PROFILE_ZONE(name)
+	/// Times the rest of the current scope as a zone named after a
+	/// Component. Compiled out because GLASS_DISABLE_PROFILER is
+	/// defined.
+	#define GLASS_PROFILE_COMPONENT(component)
+#endif
+
+namespace gs {
+	namespace util {
+		///////////////////////////////////////////////////////////
+		/// class Profiler records timed zones from every thread
+		/// and exports them as Chrome trace JSON, which can be
+		/// opened in chrome://tracing or ui.perfetto.dev. Every
+		/// thread records into its own ring buffer so recording
+		/// never takes a lock. While disabled a zone costs a
+		/// single atomic load. Wrap the call sites you want to
+		/// see with GLASS_PROFILE_ZONE():
+		///
+		/// gs::util::Profiler::setEnabled(true);
+		///
+		/// while (window.isOpen()) {
+		/// 	gs::util::Profiler::markFrame();
+		/// 	{
+		/// 		GLASS_PROFILE_ZONE("updateInputs");
+		/// 		gs::input::updateInputs();
+		/// 	}
+		/// 	...
+		/// }
+		///
+		/// gs::util::Profiler::exportFrame("spike.json");
+		///////////////////////////////////////////////////////////
+		class Profiler {
+		public:
+			///////////////////////////////////////////////////////////
+			/// struct Zone is a single recorded zone.
+			///////////////////////////////////////////////////////////
+			struct Zone {
+				/// Name of zone.
+				const char* name;
+				/// Nanoseconds from the Profiler epoch to the start.
+				long long start;
+				/// Length in nanoseconds.
+				long long duration;
+			};
+
+			///////////////////////////////////////////////////////////
+			/// Method setEnabled() will start or stop recording.
+			/// @param bool enabled: True to record zones.
+			///////////////////////////////////////////////////////////
+			static void setEnabled(bool enabled);
+			///////////////////////////////////////////////////////////
+			/// Method setThreadName() will name the calling thread in
+			/// exported traces.
+			/// @param const std::string& name: Name of thread.
+			///////////////////////////////////////////////////////////
+			static void setThreadName(const std::string& name);
+			///////////////////////////////////////////////////////////
+			/// Method markFrame() will start a new frame. Call it once
+			/// at the start of every frame on the UI thread.
+			///////////////////////////////////////////////////////////
+			static void markFrame();
+			///////////////////////////////////////////////////////////
+			/// Method record() will record a finished zone on the
+			/// calling thread. Usually called by ProfileZone.
+			/// @param const char* name: Name of zone.
+			/// @param long long start: Start from now().
+			/// @param long long end: End from now().
+			///////////////////////////////////////////////////////////
+			static void record(const char* name, long long start, long long end);
+
+			///////////////////////////////////////////////////////////
+			/// Method exportFrame() will write the zones of the last
+			/// finished frame as Chrome trace JSON.
+			/// @param std::ostream& os: Where to write.
+			///////////////////////////////////////////////////////////
+			static void exportFrame(std::ostream& os);
+			///////////////////////////////////////////////////////////
+			/// Method exportFrame() will write the zones of the last
+			/// finished frame to a Chrome trace JSON file.
+			/// @param const std::string& path: Path of file.
+			/// @returns bool: False if the file couldn't be opened.
+			///////////////////////////////////////////////////////////
+			static bool exportFrame(const std::string& path);
+			///////////////////////////////////////////////////////////
+			/// Method exportAll() will write every zone still in the
+			/// ring buffers as Chrome trace JSON.
+			/// @param std::ostream& os: Where to write.
+			///////////////////////////////////////////////////////////
+			static void exportAll(std::ostream& os);
+
+			///////////////////////////////////////////////////////////
+			/// @returns bool: True if zones are being recorded.
+			///////////////////////////////////////////////////////////
+			static bool isEnabled();
+			///////////////////////////////////////////////////////////
+			/// @returns long long: Nanoseconds from the Profiler
+			///  epoch on a steady clock.
+			///////////////////////////////////////////////////////////
+			static long long now();
+		protected:
+			/// Number of zones each thread keeps. A power of two.
+			static const size_t zoneCapacity = 16384;
+
+			///////////////////////////////////////////////////////////
+			/// struct ZoneSlot is a Zone in a ring buffer. The fields
+			/// are atomic so exporting can read them while the thread
+			/// overwrites them, torn copies are then thrown away.
+			///////////////////////////////////////////////////////////
+			struct ZoneSlot {
+				/// Name of zone.
+				std::atomic<const char*> name{ nullptr };
+				/// Nanoseconds from the Profiler epoch to the start.
+				std::atomic<long long> start{ 0 };
+				/// Length in nanoseconds.
+				std::atomic<long long> duration{ 0 };
+			};
+
+			///////////////////////////////////////////////////////////
+			/// struct ThreadBuffer is the ring buffer of a thread. It
+			/// is only written by its thread.
+			///////////////////////////////////////////////////////////
+			struct ThreadBuffer {
+				/// Recorded zones.
+				std::unique_ptr<ZoneSlot[]> zones;
+				/// Number of zones the thread started to write.
+				std::atomic<size_t> begun{ 0 };
+				/// Number of zones ever recorded.
+				std::atomic<size_t> written{ 0 };
+				/// Id of thread in exported traces.
+				size_t id = 0;
+				/// Name of thread in exported traces.
+				std::string name;
+				/// True once the thread ended. Its buffer is given to
+				/// the next new thread.
+				bool retired = false;
+			};
+
+			///////////////////////////////////////////////////////////
+			/// struct ThreadBufferOwner retires the buffer of a thread
+			/// when the thread ends.
+			///////////////////////////////////////////////////////////
+			struct ThreadBufferOwner {
+				/// Buffer of the thread or nullptr.
+				ThreadBuffer* buffer = nullptr;
+
+				~ThreadBufferOwner();
+			};
+
+			///////////////////////////////////////////////////////////
+			/// struct State is the shared state of the Profiler.
+			///////////////////////////////////////////////////////////
+			struct State {
+				/// True while recording.
+				std::atomic<bool> enabled{ false };
+				/// Start of the last finished frame.
+				std::atomic<long long> previousFrame{ 0 };
+				/// Start of the current frame.
+				std::atomic<long long> currentFrame{ 0 };
+				/// Guards threads. Only locked to add or retire a thread
+				/// or export.
+				std::mutex mutex;
+				/// Buffer of every thread that recorded a zone. A buffer
+				/// is kept after its thread ends so it can be exported,
+				/// until a new thread reuses it.
+				vector<std::unique_ptr<ThreadBuffer>> threads;
+				/// Number of threads that recorded a zone.
+				size_t threadCount = 0;
+			};
+
+			///////////////////////////////////////////////////////////
+			/// @returns State&: Shared state of the Profiler.
+			///////////////////////////////////////////////////////////
+			static State& getState();
+			///////////////////////////////////////////////////////////
+			/// @returns ThreadBuffer&: Buffer of the calling thread.
+			///////////////////////////////////////////////////////////
+			static ThreadBuffer& getThreadBuffer();
+			///////////////////////////////////////////////////////////
+			/// Method exportRange() will write the zones that start
+			/// within a range of time as Chrome trace JSON.
+			/// @param std::ostream& os: Where to write.
+			/// @param long long from: First time to include.
+			/// @param long long to: Time after the last to include.
+			///////////////////////////////////////////////////////////
+			static void exportRange(std::ostream& os, long long from, long long to);
+			///////////////////////////////////////////////////////////
+			/// Method writeString() will write a JSON string.
+			/// @param std::ostream& os: Where to write.
+			/// @param const char* string: String to escape.
+			///////////////////////////////////////////////////////////
+			static void writeString(std::ostream& os, const char* string);
+			///////////////////////////////////////////////////////////
+			/// Method writeMicroseconds() will write nanoseconds as
+			/// microseconds with three decimals, without touching the
+			/// formatting state of the stream.
+			/// @param std::ostream& os: Where to write.
+			/// @param long long nanoseconds: Time to write.
+			///////////////////////////////////////////////////////////
+			static void writeMicroseconds(std::ostream& os, long long nanoseconds);
+		};
+
+		///////////////////////////////////////////////////////////
+		/// class ProfileZone records the time between its creation
+		/// and destruction as a zone. Use GLASS_PROFILE_ZONE()
+		/// instead of creating one directly.
+		///////////////////////////////////////////////////////////
+		class ProfileZone {
+		public:
+			///////////////////////////////////////////////////////////
+			/// @param const char* name: Name of zone. It must outlive
+			///  the Profiler, a string literal is best.
+			///////////////////////////////////////////////////////////
+			explicit ProfileZone(const char* name);
+			~ProfileZone();
+			ProfileZone(const ProfileZone&) = delete;
+			ProfileZone& operator=(const ProfileZone&) = delete;
+		protected:
+			/// Name of zone. Null if the Profiler was disabled.
+			const char* name;
+			/// Start of zone.
+			long long start = 0;
+		};
+
+		///////////////////////////////////////////////////////////
+		/// Profiler
+		///////////////////////////////////////////////////////////
+
+		inline void Profiler::setEnabled(bool enabled) {
+			getState().enabled.store(enabled, std::memory_order_relaxed);
+		}
+		inline void Profiler::setThreadName(const std::string& name) {
+			ThreadBuffer& buffer = getThreadBuffer();
+			std::lock_guard<std::mutex> lock(getState().mutex);
+			buffer.name = name;
+		}
+		inline void Profiler::markFrame() {
+			State& state = getState();
+			const long long time = now();
+
+			state.previousFrame.store(
+				state.currentFrame.exchange(time, std::memory_order_relaxed),
+				std::memory_order_relaxed
+			);
+		}
+		inline void Profiler::record(const char* name, long long start, long long end) {
+			ThreadBuffer& buffer = getThreadBuffer();
+			const size_t index = buffer.written.load(std::memory_order_relaxed);
+			ZoneSlot& slot = buffer.zones[index & (zoneCapacity - 1)];
+
+			// Announce the slot before overwriting it so exportRange()
+			// can tell the zone it held is gone.
+			buffer.begun.store(index + 1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+
+			slot.name.store(name, std::memory_order_relaxed);
+			slot.start.store(start, std::memory_order_relaxed);
+			slot.duration.store(end - start, std::memory_order_relaxed);
+			buffer.written.store(index + 1, std::memory_order_release);
+		}
+
+		inline void Profiler::exportFrame(std::ostream& os) {
+			State& state = getState();
+			exportRange(os,
+				state.previousFrame.load(std::memory_order_relaxed),
+				state.currentFrame.load(std::memory_order_relaxed)
+			);
+		}
+		inline bool Profiler::exportFrame(const std::string& path) {
+			std::ofstream file(path);
+			if (!file.is_open())
+				return false;
+
+			exportFrame(file);
+			return true;
+		}
+		inline void Profiler::exportAll(std::ostream& os) {
+			exportRange(os, 0, now() + 1);
+		}
+
+		inline bool Profiler::isEnabled() {
+			return getState().enabled.load(std::memory_order_relaxed);
+		}
+		inline long long Profiler::now() {
+			static const std::chrono::steady_clock::time_point epoch
+				= std::chrono::steady_clock::now();
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now() - epoch).count();
+		}
+
+		inline Profiler::State& Profiler::getState() {
+			static State state;
+			return state;
+		}
+		inline Profiler::ThreadBuffer& Profiler::getThreadBuffer() {
+			thread_local ThreadBufferOwner owner;
+
+			if (owner.buffer == nullptr) {
+				State& state = getState();
+				std::lock_guard<std::mutex> lock(state.mutex);
+				ThreadBuffer* buffer = nullptr;
+
+				// Reuse the buffer of a thread that ended so the memory
+				// doesn't grow with every short lived thread.
+				for (const std::unique_ptr<ThreadBuffer>& thread : state.threads)
+					if (thread->retired) {
+						buffer = thread.get();
+						break;
+					}
+
+				if (buffer == nullptr) {
+					state.threads.emplace_back(new ThreadBuffer());
+					buffer = state.threads.back().get();
+					buffer->zones.reset(new ZoneSlot[zoneCapacity]);
+				}
+
+				buffer->begun.store(0, std::memory_order_relaxed);
+				buffer->written.store(0, std::memory_order_relaxed);
+				buffer->id = ++state.threadCount;
+				buffer->name = "Thread " + std::to_string(buffer->id);
+				buffer->retired = false;
+				owner.buffer = buffer;
+			}
+			return *owner.buffer;
+		}
+		inline void Profiler::exportRange(std::ostream& os, long long from, long long to) {
+			State& state = getState();
+			std::lock_guard<std::mutex> lock(state.mutex);
+			vector<Zone> zones;
+			bool first = true;
+
+			os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+			for (const std::unique_ptr<ThreadBuffer>& thread : state.threads) {
+				os << (first ? "" : ",") << "{\"name\":\"thread_name\",\"ph\":\"M\","
+					<< "\"pid\":1,\"tid\":" << thread->id << ",\"args\":{\"name\":";
+				writeString(os, thread->name.c_str());
+				os << "}}";
+				first = false;
+
+				// Copy the zones, then drop any the thread started to
+				// overwrite while they were being copied.
+				const size_t written = thread->written.load(std::memory_order_acquire);
+				const size_t oldest = written > zoneCapacity ? written - zoneCapacity : 0;
+
+				zones.clear();
+				for (size_t i = oldest; i < written; i++) {
+					const ZoneSlot& slot = thread->zones[i & (zoneCapacity - 1)];
+					zones.push_back(Zone{
+						slot.name.load(std::memory_order_relaxed),
+						slot.start.load(std::memory_order_relaxed),
+						slot.duration.load(std::memory_order_relaxed)
+					});
+				}
+
+				std::atomic_thread_fence(std::memory_order_acquire);
+				const size_t begun = thread->begun.load(std::memory_order_relaxed);
+				const size_t valid = begun > zoneCapacity ? begun - zoneCapacity : 0;
+				const size_t skipped = valid > oldest ? valid - oldest : 0;
+
+				for (size_t i = skipped; i < zones.size(); i++) {
+					const Zone& zone = zones[i];
+					if (zone.start < from || zone.start >= to)
+						continue;
+
+					os << ",{\"name\":";
+					writeString(os, zone.name);
+					os << ",\"cat\":\"glass\",\"ph\":\"X\",\"pid\":1,\"tid\":" << thread->id
+						<< ",\"ts\":";
+					writeMicroseconds(os, zone.start);
+					os << ",\"dur\":";
+					writeMicroseconds(os, zone.duration);
+					os << "}";
+				}
+			}
+
+			os << "]}";
+		}
+		inline void Profiler::writeString(std::ostream& os, const char* string) {
+			os << '"';
+			for (const char* c = string; *c != '\0'; c++) {
+				if (*c == '"' || *c == '\\')
+					os << '\\' << *c;
+				else if (static_cast<unsigned char>(*c) < 0x20)
+					os << ' ';
+				else
+					os << *c;
+			}
+			os << '"';
+		}
+		inline void Profiler::writeMicroseconds(std::ostream& os, long long nanoseconds) {
+			const long long fraction = nanoseconds % 1000;
+			os << nanoseconds / 1000 << '.'
+				<< fraction / 100 << fraction / 10 % 10 << fraction % 10;
+		}
+
+		inline Profiler::ThreadBufferOwner::~ThreadBufferOwner() {
+			if (buffer == nullptr)
+				return;
+
+			std::lock_guard<std::mutex> lock(getState().mutex);
+			buffer->retired = true;
+		}
+
+		///////////////////////////////////////////////////////////
+		/// ProfileZone
+		///////////////////////////////////////////////////////////
+
+		inline ProfileZone::ProfileZone(const char* name)
+			: name(Profiler::isEnabled() ? name : nullptr) {
+			if (this->name != nullptr)
+				start = Profiler::now();
+		}
+		inline ProfileZone::~ProfileZone() {
+			if (name != nullptr)
+				Profiler::record(name, start, Profiler::now());
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,194 @@
+#pragma once
+
+// Dependencies
+#include "../typedef.hpp"
+
+namespace gs {
+	namespace util {
+		///////////////////////////////////////////////////////////
+		/// class RingBuffer is a fixed capacity queue. Pushing to
+		/// a full RingBuffer overwrites the oldest value so every
+		/// push is O(1) and never allocates.
+		///////////////////////////////////////////////////////////
+		template <typename Type>
+		class RingBuffer {
+		public:
+			RingBuffer() = default;
+			///////////////////////////////////////////////////////////
+			/// @param size_t capacity: Maximum number of values.
+			///////////////////////////////////////////////////////////
+			explicit RingBuffer(size_t capacity);
+			~RingBuffer() = default;
+
+			///////////////////////////////////////////////////////////
+			/// Method push() will add a value after the newest value.
+			/// If the RingBuffer is full the oldest value is removed.
+			/// @param const Type& value: Value to add.
+			///////////////////////////////////////////////////////////
+			void push(const Type& value);
+			///////////////////////////////////////////////////////////
+			/// Method pop() will remove the oldest value. Note: The
+			/// RingBuffer must not be empty.
+			///////////////////////////////////////////////////////////
+			void pop();
+			///////////////////////////////////////////////////////////
+			/// Method popBack() will remove the newest value. Note:
+			/// The RingBuffer must not be empty.
+			///////////////////////////////////////////////////////////
+			void popBack();
+			///////////////////////////////////////////////////////////
+			/// Method clear() will remove all of the values.
+			///////////////////////////////////////////////////////////
+			void clear();
+			///////////////////////////////////////////////////////////
+			/// Method setCapacity() will change the maximum number of
+			/// values. The newest values are kept.
+			/// @param size_t capacity: New maximum number of values.
+			///////////////////////////////////////////////////////////
+			void setCapacity(size_t capacity);
+
+			///////////////////////////////////////////////////////////
+			/// @param size_t index: 0 is the oldest value.
+			/// @returns const Type&: Value at the index.
+			///////////////////////////////////////////////////////////
+			const Type& operator[](size_t index) const;
+			///////////////////////////////////////////////////////////
+			/// @param size_t index: 0 is the oldest value.
+			/// @returns Type&: Value at the index.
+			///////////////////////////////////////////////////////////
+			Type& operator[](size_t index);
+			///////////////////////////////////////////////////////////
+			/// @returns const Type&: Oldest value.
+			///////////////////////////////////////////////////////////
+			const Type& front() const;
+			///////////////////////////////////////////////////////////
+			/// @returns const Type&: Newest value.
+			///////////////////////////////////////////////////////////
+			const Type& back() const;
+
+			///////////////////////////////////////////////////////////
+			/// @returns size_t: Number of values stored.
+			///////////////////////////////////////////////////////////
+			size_t size() const;
+			///////////////////////////////////////////////////////////
+			/// @returns size_t: Maximum number of values.
+			///////////////////////////////////////////////////////////
+			size_t capacity() const;
+			///////////////////////////////////////////////////////////
+			/// @returns bool: True if no values are stored.
+			///////////////////////////////////////////////////////////
+			bool empty() const;
+			///////////////////////////////////////////////////////////
+			/// @returns bool: True if size() equals capacity().
+			///////////////////////////////////////////////////////////
+			bool full() const;
+			///////////////////////////////////////////////////////////
+			/// @returns size_t: Total number of values ever pushed.
+			///  This can be used as a stable index of a value.
+			///////////////////////////////////////////////////////////
+			size_t getPushCount() const;
+		protected:
+			/// Storage of the values.
+			vector<Type> values;
+			/// Index of the oldest value in values.
+			size_t head = 0;
+			/// Number of values stored.
+			size_t count = 0;
+			/// Number of values ever pushed.
+			size_t pushCount = 0;
+		};
+
+		template <typename Type>
+		inline RingBuffer<Type>::RingBuffer(size_t capacity)
+			: values(capacity) {
+		}
+
+		template <typename Type>
+		inline void RingBuffer<Type>::push(const Type& value) {
+			pushCount++;
+
+			if (values.empty())
+				return;
+
+			size_t tail = head + count;
+			if (tail >= values.size())
+				tail -= values.size();
+
+			values[tail] = value;
+
+			if (count == values.size()) {
+				if (++head == values.size())
+					head = 0;
+			}
+			else
+				count++;
+		}
+		template <typename Type>
+		inline void RingBuffer<Type>::pop() {
+			if (++head == values.size())
+				head = 0;
+			count--;
+		}
+		template <typename Type>
+		inline void RingBuffer<Type>::popBack() {
+			count--;
+		}
+		template <typename Type>
+		inline void RingBuffer<Type>::clear() {
+			head = 0;
+			count = 0;
+		}
+		template <typename Type>
+		inline void RingBuffer<Type>::setCapacity(size_t capacity) {
+			const size_t kept = count < capacity ? count : capacity;
+			vector<Type> resized(capacity);
+
+			for (size_t i = 0; i < kept; i++)
+				resized[i] = (*this)[count - kept + i];
+
+			values.swap(resized);
+			head = 0;
+			count = kept;
+		}
+
+		template <typename Type>
+		inline const Type& RingBuffer<Type>::operator[](size_t index) const {
+			index += head;
+			return values[index >= values.size() ? index - values.size() : index];
+		}
+		template <typename Type>
+		inline Type& RingBuffer<Type>::operator[](size_t index) {
+			index += head;
+			return values[index >= values.size() ? index - values.size() : index];
+		}
+		template <typename Type>
+		inline const Type& RingBuffer<Type>::front() const {
+			return (*this)[0];
+		}
+		template <typename Type>
+		inline const Type& RingBuffer<Type>::back() const {
+			return (*this)[count - 1];
+		}
+
+		template <typename Type>
+		inline size_t RingBuffer<Type>::size() const {
+			return count;
+		}
+		template <typename Type>
+		inline size_t RingBuffer<Type>::capacity() const {
+			return values.size();
+		}
+		template <typename Type>
+		inline bool RingBuffer<Type>::empty() const {
+			return count == 0;
+		}
+		template <typename Type>
+		inline bool RingBuffer<Type>::full() const {
+			return count == values.size();
+		}
+		template <typename Type>
+		inline size_t RingBuffer<Type>::getPushCount() const {
+			return pushCount;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,146 @@
+#pragma once
+
+// Dependencies
+#include "ringBuffer.hpp"
+
+namespace gs {
+	namespace util {
+		///////////////////////////////////////////////////////////
+		/// class SlidingWindowMinMax keeps track of the minimum and
+		/// maximum of the last windowSize values pushed. It uses a
+		/// pair of monotonic deques so push() is amortized O(1)
+		/// and getMin()/getMax() are O(1) for any window size.
+		/// NaN values take up a slot in the window but are never
+		/// reported as the minimum or maximum.
+		///////////////////////////////////////////////////////////
+		template <typename Type>
+		class SlidingWindowMinMax {
+		public:
+			SlidingWindowMinMax() = default;
+			///////////////////////////////////////////////////////////
+			/// @param size_t windowSize: Number of values in window.
+			///////////////////////////////////////////////////////////
+			explicit SlidingWindowMinMax(size_t windowSize);
+			~SlidingWindowMinMax() = default;
+
+			///////////////////////////////////////////////////////////
+			/// Method push() will add a value to the window. If the
+			/// window is full the oldest value leaves the window.
+			/// @param Type value: Value to add.
+			///////////////////////////////////////////////////////////
+			void push(Type value);
+			///////////////////////////////////////////////////////////
+			/// Method clear() will remove all of the values.
+			///////////////////////////////////////////////////////////
+			void clear();
+			///////////////////////////////////////////////////////////
+			/// Method setWindowSize() will change the number of values
+			/// in the window. Note: This clears the window, push the
+			/// kept values again to restore it.
+			/// @param size_t windowSize: Number of values in window.
+			///////////////////////////////////////////////////////////
+			void setWindowSize(size_t windowSize);
+
+			///////////////////////////////////////////////////////////
+			/// @returns bool: True if the window holds no comparable
+			///  values. getMin() and getMax() are invalid if true.
+			///////////////////////////////////////////////////////////
+			bool empty() const;
+			///////////////////////////////////////////////////////////
+			/// @returns Type: Minimum value in window.
+			///////////////////////////////////////////////////////////
+			Type getMin() const;
+			///////////////////////////////////////////////////////////
+			/// @returns Type: Maximum value in window.
+			///////////////////////////////////////////////////////////
+			Type getMax() const;
+			///////////////////////////////////////////////////////////
+			/// @returns size_t: Number of values in window.
+			///////////////////////////////////////////////////////////
+			size_t getWindowSize() const;
+		protected:
+			///////////////////////////////////////////////////////////
+			/// struct Entry is a value and the push count it was
+			/// pushed at.
+			///////////////////////////////////////////////////////////
+			struct Entry {
+				size_t index;
+				Type value;
+			};
+
+			/// Entries with increasing values. Front is the minimum.
+			RingBuffer<Entry> minimums;
+			/// Entries with decreasing values. Front is the maximum.
+			RingBuffer<Entry> maximums;
+			/// Number of values in window.
+			size_t windowSize = 0;
+			/// Number of values ever pushed.
+			size_t pushCount = 0;
+		};
+
+		///////////////////////////////////////////////////////////
+		/// SlidingWindowMinMax
+		///////////////////////////////////////////////////////////
+
+		template <typename Type>
+		inline SlidingWindowMinMax<Type>::SlidingWindowMinMax(size_t windowSize)
+			: minimums(windowSize), maximums(windowSize), windowSize(windowSize) {
+		}
+
+		template <typename Type>
+		inline void SlidingWindowMinMax<Type>::push(Type value) {
+			const size_t index = pushCount++;
+
+			if (windowSize == 0)
+				return;
+
+			// Drop the entries that left the window.
+			while (!minimums.empty() && minimums.front().index + windowSize <= index)
+				minimums.pop();
+			while (!maximums.empty() && maximums.front().index + windowSize <= index)
+				maximums.pop();
+
+			if (value != value)
+				return;
+
+			// Entries dominated by the new value can never be reported.
+			while (!minimums.empty() && !(minimums.back().value < value))
+				minimums.popBack();
+			while (!maximums.empty() && !(maximums.back().value > value))
+				maximums.popBack();
+
+			minimums.push(Entry{ index, value });
+			maximums.push(Entry{ index, value });
+		}
+		template <typename Type>
+		inline void SlidingWindowMinMax<Type>::clear() {
+			minimums.clear();
+			maximums.clear();
+			pushCount = 0;
+		}
+		template <typename Type>
+		inline void SlidingWindowMinMax<Type>::setWindowSize(size_t windowSize) {
+			this->windowSize = windowSize;
+			minimums.setCapacity(windowSize);
+			maximums.setCapacity(windowSize);
+			clear();
+		}
+
+		template <typename Type>
+		inline bool SlidingWindowMinMax<Type>::empty() const {
+			return minimums.empty();
+		}
+		template <typename Type>
+		inline Type SlidingWindowMinMax<Type>::getMin() const {
+			return minimums.front().value;
+		}
+		template <typename Type>
+		inline Type SlidingWindowMinMax<Type>::getMax() const {
+			return maximums.front().value;
+		}
+		template <typename Type>
+		inline size_t SlidingWindowMinMax<Type>::getWindowSize() const {
+			return windowSize;
+		}
+	}
+}
\ No newline at end of file
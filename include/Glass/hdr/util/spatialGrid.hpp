@@ -0,0 +1,241 @@
+#pragma once
+
+// Dependencies
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+
+#include "../typedef.hpp"
+
+namespace gs {
+	namespace util {
+		///////////////////////////////////////////////////////////
+		/// class SpatialGrid is a uniform grid of rectangles used
+		/// to find which rectangles contain a point without testing
+		/// every one of them. Each rectangle is stored in every
+		/// cell it overlaps. Rectangles that would cover too many
+		/// cells are kept in a list that every query checks. Ids
+		/// are small indices chosen by the caller, such as the
+		/// index of a Component in a Menu.
+		///////////////////////////////////////////////////////////
+		class SpatialGrid {
+		public:
+			///////////////////////////////////////////////////////////
+			/// @param float cellSize: Width and height of a cell.
+			///////////////////////////////////////////////////////////
+			explicit SpatialGrid(float cellSize = 64.0f);
+			~SpatialGrid() = default;
+
+			///////////////////////////////////////////////////////////
+			/// Method set() will add a rectangle or move it if the id
+			/// is already in the grid. Cells are only touched if the
+			/// rectangle changed.
+			/// @param size_t id: Id of rectangle.
+			/// @param const sf::FloatRect& bounds: Rectangle.
+			/// @returns bool: True if the grid changed.
+			///////////////////////////////////////////////////////////
+			bool set(size_t id, const sf::FloatRect& bounds);
+			///////////////////////////////////////////////////////////
+			/// Method remove() will remove a rectangle.
+			/// @param size_t id: Id of rectangle.
+			///////////////////////////////////////////////////////////
+			void remove(size_t id);
+			///////////////////////////////////////////////////////////
+			/// Method clear() will remove all of the rectangles.
+			///////////////////////////////////////////////////////////
+			void clear();
+			///////////////////////////////////////////////////////////
+			/// Method setCellSize() will change the size of the cells
+			/// and reinsert every rectangle. Cells about the size of
+			/// the typical rectangle work best.
+			/// @param float cellSize: Width and height of a cell.
+			///////////////////////////////////////////////////////////
+			void setCellSize(float cellSize);
+
+			///////////////////////////////////////////////////////////
+			/// Method query() will find the rectangles containing a
+			/// point. O(rectangles in the cell of the point).
+			/// @param Vec2f point: Point to test.
+			/// @param vector<size_t>& ids: Cleared and then filled
+			///  with the ids in increasing order.
+			///////////////////////////////////////////////////////////
+			void query(Vec2f point, vector<size_t>& ids) const;
+
+			///////////////////////////////////////////////////////////
+			/// @returns float: Width and height of a cell.
+			///////////////////////////////////////////////////////////
+			float getCellSize() const;
+			///////////////////////////////////////////////////////////
+			/// @param size_t id: Id of rectangle.
+			/// @returns bool: True if the id is in the grid.
+			///////////////////////////////////////////////////////////
+			bool contains(size_t id) const;
+		protected:
+			/// Most cells a rectangle may cover before it is oversized.
+			static const long long maxCellsPerRectangle = 64;
+
+			///////////////////////////////////////////////////////////
+			/// struct Entry is the stored state of an id.
+			///////////////////////////////////////////////////////////
+			struct Entry {
+				sf::FloatRect bounds;
+				bool active = false;
+				bool oversized = false;
+			};
+
+			/// Width and height of a cell.
+			float cellSize;
+			/// State of every id.
+			vector<Entry> entries;
+			/// Ids in every non empty cell.
+			std::unordered_map<std::uint64_t, vector<size_t>> cells;
+			/// Ids of oversized rectangles.
+			vector<size_t> oversized;
+
+			///////////////////////////////////////////////////////////
+			/// Method link() will add or remove an id in the cells its
+			/// rectangle covers.
+			/// @param size_t id: Id of rectangle.
+			/// @param bool insert: True to add, false to remove.
+			///////////////////////////////////////////////////////////
+			void link(size_t id, bool insert);
+			///////////////////////////////////////////////////////////
+			/// @param float coordinate: Position on an axis.
+			/// @returns long long: Cell index on that axis.
+			///////////////////////////////////////////////////////////
+			long long cellOf(float coordinate) const;
+			///////////////////////////////////////////////////////////
+			/// @returns std::uint64_t: Key of the cell at x, y.
+			///////////////////////////////////////////////////////////
+			static std::uint64_t keyOf(long long x, long long y);
+		};
+
+		///////////////////////////////////////////////////////////
+		/// SpatialGrid
+		///////////////////////////////////////////////////////////
+
+		inline SpatialGrid::SpatialGrid(float cellSize)
+			: cellSize(cellSize > 0.0f ? cellSize : 64.0f) {
+		}
+
+		inline bool SpatialGrid::set(size_t id, const sf::FloatRect& bounds) {
+			if (id >= entries.size())
+				entries.resize(id + 1);
+
+			Entry& entry = entries[id];
+			if (entry.active && entry.bounds == bounds)
+				return false;
+
+			if (entry.active)
+				link(id, false);
+
+			entry.bounds = bounds;
+			entry.active = true;
+			link(id, true);
+			return true;
+		}
+		inline void SpatialGrid::remove(size_t id) {
+			if (!contains(id))
+				return;
+
+			link(id, false);
+			entries[id].active = false;
+		}
+		inline void SpatialGrid::clear() {
+			entries.clear();
+			cells.clear();
+			oversized.clear();
+		}
+		inline void SpatialGrid::setCellSize(float cellSize) {
+			if (cellSize <= 0.0f || cellSize == this->cellSize)
+				return;
+
+			for (size_t id = 0; id < entries.size(); id++)
+				if (entries[id].active)
+					link(id, false);
+
+			this->cellSize = cellSize;
+
+			for (size_t id = 0; id < entries.size(); id++)
+				if (entries[id].active)
+					link(id, true);
+		}
+
+		inline void SpatialGrid::query(Vec2f point, vector<size_t>& ids) const {
+			ids.clear();
+
+			auto inside = [&point](const sf::FloatRect& bounds) {
+				return point.x >= bounds.left && point.x <= bounds.left + bounds.width
+					&& point.y >= bounds.top && point.y <= bounds.top + bounds.height;
+			};
+
+			const auto cell = cells.find(keyOf(cellOf(point.x), cellOf(point.y)));
+			if (cell != cells.end())
+				for (size_t id : cell->second)
+					if (inside(entries[id].bounds))
+						ids.push_back(id);
+
+			for (size_t id : oversized)
+				if (inside(entries[id].bounds))
+					ids.push_back(id);
+
+			std::sort(ids.begin(), ids.end());
+		}
+
+		inline float SpatialGrid::getCellSize() const {
+			return cellSize;
+		}
+		inline bool SpatialGrid::contains(size_t id) const {
+			return id < entries.size() && entries[id].active;
+		}
+
+		inline void SpatialGrid::link(size_t id, bool insert) {
+			Entry& entry = entries[id];
+			const sf::FloatRect& bounds = entry.bounds;
+			const long long left = cellOf(bounds.left);
+			const long long right = cellOf(bounds.left + bounds.width);
+			const long long top = cellOf(bounds.top);
+			const long long bottom = cellOf(bounds.top + bounds.height);
+
+			if (insert)
+				entry.oversized = (right - left + 1) * (bottom - top + 1) > maxCellsPerRectangle;
+
+			if (entry.oversized) {
+				if (insert)
+					oversized.push_back(id);
+				else
+					oversized.erase(std::find(oversized.begin(), oversized.end(), id));
+				return;
+			}
+
+			for (long long y = top; y <= bottom; y++) {
+				for (long long x = left; x <= right; x++) {
+					if (insert) {
+						cells[keyOf(x, y)].push_back(id);
+						continue;
+					}
+
+					const auto cell = cells.find(keyOf(x, y));
+					if (cell == cells.end())
+						continue;
+
+					vector<size_t>& ids = cell->second;
+					ids.erase(std::find(ids.begin(), ids.end(), id));
+					if (ids.empty())
+						cells.erase(cell);
+				}
+			}
+		}
+		inline long long SpatialGrid::cellOf(float coordinate) const {
+			const float cell = std::floor(coordinate / cellSize);
+			const float limit = 1e9f;
+			if (cell != cell)
+				return 0;
+			return static_cast<long long>(cell < -limit ? -limit : cell > limit ? limit : cell);
+		}
+		inline std::uint64_t SpatialGrid::keyOf(long long x, long long y) {
+			return (static_cast<std::uint64_t>(x) << 32) ^ (static_cast<std::uint64_t>(y) & 0xffffffffull);
+		}
+	}
+}
\ No newline at end of file
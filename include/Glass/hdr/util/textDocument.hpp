@@ -0,0 +1,236 @@
+#pragma once
+
+// Dependencies
+#include <string>
+
+#include "gapBuffer.hpp"
+
+namespace gs {
+	namespace util {
+		///////////////////////////////////////////////////////////
+		/// class TextDocument is multi-line text with a cursor for
+		/// editors. The characters are kept in a GapBuffer with the
+		/// gap at the cursor and the newline positions in a second
+		/// GapBuffer. Newlines before the cursor store their
+		/// position and newlines after it store their distance
+		/// from the end, so typing never has to shift the line
+		/// index. Typing at the cursor is amortized O(1) and
+		/// finding the start of a line is O(1) at any size.
+		///////////////////////////////////////////////////////////
+		class TextDocument {
+		public:
+			TextDocument() = default;
+			~TextDocument() = default;
+
+			///////////////////////////////////////////////////////////
+			/// Method insert() will type a character at the cursor.
+			/// @param char character: Character to add.
+			///////////////////////////////////////////////////////////
+			void insert(char character);
+			///////////////////////////////////////////////////////////
+			/// Method insert() will type a string at the cursor.
+			/// @param const std::string& string: String to add.
+			///////////////////////////////////////////////////////////
+			void insert(const std::string& string);
+			///////////////////////////////////////////////////////////
+			/// Method eraseBefore() will remove characters before the
+			/// cursor like backspace.
+			/// @param size_t count: Number of characters.
+			/// @returns size_t: Number of characters removed.
+			///////////////////////////////////////////////////////////
+			size_t eraseBefore(size_t count = 1);
+			///////////////////////////////////////////////////////////
+			/// Method eraseAfter() will remove characters after the
+			/// cursor like delete.
+			/// @param size_t count: Number of characters.
+			/// @returns size_t: Number of characters removed.
+			///////////////////////////////////////////////////////////
+			size_t eraseAfter(size_t count = 1);
+			///////////////////////////////////////////////////////////
+			/// Method setCursor() will move the cursor. O(characters
+			/// moved over).
+			/// @param size_t position: Character index. It is clamped.
+			///////////////////////////////////////////////////////////
+			void setCursor(size_t position);
+			///////////////////////////////////////////////////////////
+			/// Method setString() will replace all of the text and
+			/// put the cursor at the end.
+			/// @param const std::string& string: New text.
+			///////////////////////////////////////////////////////////
+			void setString(const std::string& string);
+			///////////////////////////////////////////////////////////
+			/// Method clear() will remove all of the text.
+			///////////////////////////////////////////////////////////
+			void clear();
+
+			///////////////////////////////////////////////////////////
+			/// @returns size_t: Number of characters.
+			///////////////////////////////////////////////////////////
+			size_t size() const;
+			///////////////////////////////////////////////////////////
+			/// @returns size_t: Character index of the cursor.
+			///////////////////////////////////////////////////////////
+			size_t getCursor() const;
+			///////////////////////////////////////////////////////////
+			/// @param size_t position: Character index.
+			/// @returns char: Character at the index.
+			///////////////////////////////////////////////////////////
+			char operator[](size_t position) const;
+			///////////////////////////////////////////////////////////
+			/// @returns size_t: Number of lines. At least 1.
+			///////////////////////////////////////////////////////////
+			size_t getLineCount() const;
+			///////////////////////////////////////////////////////////
+			/// @param size_t line: Line index.
+			/// @returns size_t: Index of the first character.
+			///////////////////////////////////////////////////////////
+			size_t getLineStart(size_t line) const;
+			///////////////////////////////////////////////////////////
+			/// @param size_t line: Line index.
+			/// @returns size_t: Index of the newline ending the line
+			///  or size() for the last line.
+			///////////////////////////////////////////////////////////
+			size_t getLineEnd(size_t line) const;
+			///////////////////////////////////////////////////////////
+			/// Method getLineOf() will find the line of a character.
+			/// O(log lines).
+			/// @param size_t position: Character index.
+			/// @returns size_t: Line index.
+			///////////////////////////////////////////////////////////
+			size_t getLineOf(size_t position) const;
+			///////////////////////////////////////////////////////////
+			/// Method getLine() will copy a line without its newline.
+			/// @param size_t line: Line index.
+			/// @param std::string& string: Replaced with the line.
+			/// @param size_t maxLength: Most characters to copy.
+			///////////////////////////////////////////////////////////
+			void getLine(size_t line, std::string& string,
+				size_t maxLength = static_cast<size_t>(-1)) const;
+			///////////////////////////////////////////////////////////
+			/// @returns std::string: Copy of all of the text. O(n).
+			///////////////////////////////////////////////////////////
+			std::string getString() const;
+		protected:
+			/// Characters with the gap at the cursor.
+			GapBuffer<char> text;
+			/// Newlines before the gap as positions and after it as
+			/// distances from the end.
+			GapBuffer<size_t> newlines;
+
+			///////////////////////////////////////////////////////////
+			/// @param size_t index: Index of a newline.
+			/// @returns size_t: Character index of the newline.
+			///////////////////////////////////////////////////////////
+			size_t newlineAt(size_t index) const;
+			///////////////////////////////////////////////////////////
+			/// @param size_t position: Character index.
+			/// @returns size_t: Number of newlines before it.
+			///////////////////////////////////////////////////////////
+			size_t newlinesBefore(size_t position) const;
+		};
+
+		///////////////////////////////////////////////////////////
+		/// TextDocument
+		///////////////////////////////////////////////////////////
+
+		inline void TextDocument::insert(char character) {
+			if (character == '\n')
+				newlines.insert(text.getGap());
+			text.insert(character);
+		}
+		inline void TextDocument::insert(const std::string& string) {
+			const size_t cursor = text.getGap();
+			for (size_t i = 0; i < string.size(); i++)
+				if (string[i] == '\n')
+					newlines.insert(cursor + i);
+			text.insert(string.data(), string.size());
+		}
+		inline size_t TextDocument::eraseBefore(size_t count) {
+			count = std::min(count, text.getGap());
+			for (size_t i = 0; i < count; i++)
+				if (text[text.getGap() - 1 - i] == '\n')
+					newlines.eraseBefore();
+			return text.eraseBefore(count);
+		}
+		inline size_t TextDocument::eraseAfter(size_t count) {
+			count = std::min(count, text.size() - text.getGap());
+			for (size_t i = 0; i < count; i++)
+				if (text[text.getGap() + i] == '\n')
+					newlines.eraseAfter();
+			return text.eraseAfter(count);
+		}
+		inline void TextDocument::setCursor(size_t position) {
+			position = std::min(position, text.size());
+
+			const size_t gap = newlines.getGap();
+			const size_t target = newlinesBefore(position);
+			newlines.moveGap(target);
+
+			// Newlines that crossed the gap switch between positions
+			// and distances from the end.
+			for (size_t i = std::min(gap, target); i < std::max(gap, target); i++)
+				newlines[i] = text.size() - newlines[i];
+
+			text.moveGap(position);
+		}
+		inline void TextDocument::setString(const std::string& string) {
+			clear();
+			insert(string);
+		}
+		inline void TextDocument::clear() {
+			text.clear();
+			newlines.clear();
+		}
+
+		inline size_t TextDocument::size() const {
+			return text.size();
+		}
+		inline size_t TextDocument::getCursor() const {
+			return text.getGap();
+		}
+		inline char TextDocument::operator[](size_t position) const {
+			return text[position];
+		}
+		inline size_t TextDocument::getLineCount() const {
+			return newlines.size() + 1;
+		}
+		inline size_t TextDocument::getLineStart(size_t line) const {
+			if (line == 0)
+				return 0;
+			if (line > newlines.size())
+				return text.size();
+			return newlineAt(line - 1) + 1;
+		}
+		inline size_t TextDocument::getLineEnd(size_t line) const {
+			return line < newlines.size() ? newlineAt(line) : text.size();
+		}
+		inline size_t TextDocument::getLineOf(size_t position) const {
+			return newlinesBefore(position);
+		}
+		inline void TextDocument::getLine(size_t line, std::string& string, size_t maxLength) const {
+			const size_t start = getLineStart(line);
+			string.resize(std::min(getLineEnd(line) - start, maxLength));
+			text.copy(start, string.size(), &string[0]);
+		}
+		inline std::string TextDocument::getString() const {
+			std::string string(text.size(), '\0');
+			text.copy(0, string.size(), &string[0]);
+			return string;
+		}
+
+		inline size_t TextDocument::newlineAt(size_t index) const {
+			return index < newlines.getGap() ? newlines[index] : text.size() - newlines[index];
+		}
+		inline size_t TextDocument::newlinesBefore(size_t position) const {
+			size_t low = 0, high = newlines.size();
+			while (low < high) {
+				const size_t middle = low + (high - low) / 2;
+				if (newlineAt(middle) < position)
+					low = middle + 1;
+				else
+					high = middle;
+			}
+			return low;
+		}
+	}
+}
\ No newline at end of file
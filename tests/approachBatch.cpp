@@ -0,0 +1,76 @@
+///////////////////////////////////////////////////////////////////////////////
+/// Test of the batch gs::util::approach() kernels. Every color and float of
+/// an array must move exactly like approach(Color, Color, float) and
+/// approach(float, float, float) move them one at a time, for any number of
+/// colors and for percentages outside 0 to 100. The test is built twice,
+/// against the copy of approach() in math.hpp and, with
+/// GLASS_DISABLE_INLINE_MATH, against the dll.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstring>
+#include <random>
+
+#include <Glass/glass.hpp>
+
+#include "test.hpp"
+
+using test::check;
+using gs::Color;
+
+namespace {
+	bool same(const std::vector<Color>& a, const std::vector<Color>& b) {
+		return a.size() == b.size()
+			&& (a.empty() || std::memcmp(a.data(), b.data(), a.size() * sizeof(Color)) == 0);
+	}
+	bool same(const std::vector<float>& a, const std::vector<float>& b) {
+		return a.size() == b.size()
+			&& (a.empty() || std::memcmp(a.data(), b.data(), a.size() * sizeof(float)) == 0);
+	}
+}
+
+int main() {
+	std::mt19937 random(24);
+	auto channel = [&random]() { return static_cast<sf::Uint8>(random() % 256); };
+
+	// Counts around the block sizes leave every length of tail.
+	const float percentages[] = { 0.0f, 100.0f, 12.5f, 33.3f, 99.9f, -50.0f, 150.0f, -250.0f, 400.0f };
+	bool colorsMatch = true, scalarMatches = true, floatsMatch = true;
+
+	for (size_t count = 0; count <= 37; count++) {
+		for (float percentage : percentages) {
+			std::vector<Color> values(count), destinations(count);
+			std::vector<float> floats(count), floatDestinations(count);
+			for (size_t i = 0; i < count; i++) {
+				values[i] = Color(channel(), channel(), channel(), channel());
+				destinations[i] = Color(channel(), channel(), channel(), channel());
+				floats[i] = std::uniform_real_distribution<float>(-1000.0f, 1000.0f)(random);
+				floatDestinations[i] = std::uniform_real_distribution<float>(-1000.0f, 1000.0f)(random);
+			}
+
+			std::vector<Color> expected(count);
+			std::vector<float> expectedFloats(count);
+			for (size_t i = 0; i < count; i++) {
+				expected[i] = gs::util::approach(values[i], destinations[i], percentage);
+				expectedFloats[i] = gs::util::approach(floats[i], floatDestinations[i], percentage);
+			}
+
+			std::vector<Color> batch = values, scalar = values;
+			gs::util::approach(batch.data(), destinations.data(), count, percentage);
+			gs::priv::approachScalar(reinterpret_cast<std::uint8_t*>(scalar.data()),
+				reinterpret_cast<const std::uint8_t*>(destinations.data()), count * 4,
+				gs::priv::approachFactor(percentage));
+			gs::util::approach(floats.data(), floatDestinations.data(), count, percentage);
+
+			colorsMatch &= same(batch, expected);
+			scalarMatches &= same(scalar, expected);
+			floatsMatch &= same(floats, expectedFloats);
+		}
+	}
+
+	std::cout << "Instruction set: " << gs::util::getApproachInstructionSet() << std::endl;
+	check(colorsMatch, "batch colors match approach(Color, Color, float)");
+	check(scalarMatches, "scalar fallback matches approach(Color, Color, float)");
+	check(floatsMatch, "batch floats match approach(float, float, float)");
+
+	return test::report();
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+///////////////////////////////////////////////////////////////////////////////
+/// Test of gs::BufferedTextbox. Types a burst of characters in one frame,
+/// presses Enter and checks the stored string.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <Glass/glass.hpp>
+
+#include "test.hpp"
+
+using test::check;
+
+namespace {
+	void pushText(sf::Uint32 unicode) {
+		sf::Event event;
+		event.type = sf::Event::TextEntered;
+		event.text.unicode = unicode;
+		gs::input::getEventQueue().push(event);
+	}
+	void pushKey(sf::Keyboard::Key key) {
+		sf::Event event;
+		event.type = sf::Event::KeyPressed;
+		event.key = sf::Event::KeyEvent();
+		event.key.code = key;
+		gs::input::getEventQueue().push(event);
+	}
+	void typeFrame(gs::BufferedTextbox& textbox, const std::string& string, bool enter) {
+		gs::input::getEventQueue().clear();
+		for (char character : string)
+			pushText(static_cast<unsigned char>(character));
+		if (enter)
+			pushKey(sf::Keyboard::Enter);
+		textbox.update();
+	}
+}
+
+int main() {
+	gs::BufferedTextbox textbox;
+	textbox.setSize(200.0f, 40.0f);
+	textbox.setMaxInputLength(10);
+	textbox.setActive(true);
+
+	// A whole burst arrives in one frame and is kept while typing.
+	typeFrame(textbox, "Hi 5!", false);
+	check(textbox.getActive(), "textbox stays active while typing");
+	check(textbox.getStoredString().empty(), "stored string only changes on Enter");
+	check(textbox.getString().compare(0, 4, "Hi 5") == 0, "typed text is displayed");
+
+	// Backspace and the maximum length are applied in order.
+	typeFrame(textbox, std::string("x\b") + "abcdefghij", true);
+	check(!textbox.getActive(), "Enter ends typing");
+	check(textbox.getStoredString() == "Hi 5abcdef", "Enter stores the typed string");
+
+	// Numeric rejects letters, spaces and punctuation.
+	gs::BufferedTextbox numeric;
+	numeric.validInputs = gs::Textbox::ValidInputs::Numeric;
+	numeric.setActive(true);
+	typeFrame(numeric, "-1.5 a2", true);
+	check(numeric.getStoredString() == "152", "Numeric only accepts digits");
+
+	return test::report();
+}
\ No newline at end of file
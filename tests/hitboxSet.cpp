@@ -0,0 +1,112 @@
+///////////////////////////////////////////////////////////////////////////////
+/// Test of gs::HitboxSet. Fills a set with overlapping circles and
+/// rectangles and checks the SIMD and scalar code give the same masks and
+/// indices for random points and rectangles, including ones on the edges.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <random>
+
+#include <Glass/glass.hpp>
+
+#include "test.hpp"
+
+using test::check;
+
+namespace {
+	/// @returns vector<size_t>: Indices of the set bits of a mask.
+	std::vector<size_t> indicesOf(const std::vector<std::uint64_t>& mask) {
+		std::vector<size_t> indices;
+		for (size_t i = 0; i < mask.size() * 64; i++)
+			if ((mask[i / 64] >> (i % 64)) & 1)
+				indices.push_back(i);
+		return indices;
+	}
+}
+
+int main() {
+	std::mt19937 random(16);
+	std::uniform_real_distribution<float> position(-20.0f, 520.0f);
+	std::uniform_real_distribution<float> extent(0.0f, 60.0f);
+
+	// A count that isn't a multiple of the block size so the
+	// padding is tested too.
+	gs::HitboxSet simd, scalar;
+	scalar.setSimd(false);
+	std::vector<gs::Vec2f> corners;
+
+	for (size_t i = 0; i < 1003; i++) {
+		const gs::Vec2f corner(position(random), position(random));
+		const float size = extent(random);
+		corners.push_back(corner);
+
+		switch (i % 3) {
+		case 0:
+			simd.addCircle(corner, size);
+			scalar.addCircle(corner, size);
+			break;
+		case 1: {
+			const sf::FloatRect rect(corner, gs::Vec2f(size, extent(random)));
+			simd.addRectangle(rect);
+			scalar.addRectangle(rect);
+			break;
+		}
+		default: {
+			gs::Hitbox hitbox(i % 2 == 0 ? gs::Hitbox::Shape::Circle : gs::Hitbox::Shape::Rectangle);
+			hitbox.setPosition(corner);
+			hitbox.setSize(size, size);
+			hitbox.setRadius(size / 2.0f);
+			simd.add(hitbox);
+			scalar.add(hitbox);
+			break;
+		}
+		}
+	}
+
+	std::vector<std::uint64_t> simdMask, scalarMask;
+	std::vector<size_t> simdIndices, scalarIndices;
+	bool pointsMatch = true, rectsMatch = true, indicesMatch = true;
+	size_t hits = 0;
+
+	for (size_t i = 0; i < 4000; i++) {
+		// Every fourth point is a corner of a Hitbox, on its edge.
+		const gs::Vec2f point = i % 4 == 0
+			? corners[random() % corners.size()]
+			: gs::Vec2f(position(random), position(random));
+
+		simd.intersectsMask(point, simdMask);
+		scalar.intersectsMask(point, scalarMask);
+		simd.intersects(point, simdIndices);
+		scalar.intersects(point, scalarIndices);
+
+		pointsMatch &= simdMask == scalarMask;
+		indicesMatch &= simdIndices == scalarIndices && simdIndices == indicesOf(simdMask);
+		hits += simdIndices.size();
+	}
+
+	for (size_t i = 0; i < 4000; i++) {
+		// Some rectangles have no size or start on a corner.
+		const gs::Vec2f corner = i % 4 == 0
+			? corners[random() % corners.size()]
+			: gs::Vec2f(position(random), position(random));
+		const sf::FloatRect rect(corner, i % 5 == 0
+			? gs::Vec2f() : gs::Vec2f(extent(random), extent(random)));
+
+		simd.intersectsMask(rect, simdMask);
+		scalar.intersectsMask(rect, scalarMask);
+		simd.intersects(rect, simdIndices);
+		scalar.intersects(rect, scalarIndices);
+
+		rectsMatch &= simdMask == scalarMask;
+		indicesMatch &= simdIndices == scalarIndices && simdIndices == indicesOf(simdMask);
+		hits += simdIndices.size();
+	}
+
+	std::cout << "Instruction set: " << gs::HitboxSet::getInstructionSet() << std::endl;
+	check(simdMask.size() == (simd.size() + 63) / 64, "mask has a bit per Hitbox");
+	check(hits > 0, "queries hit Hitboxes");
+	check(pointsMatch, "SIMD and scalar point masks match");
+	check(rectsMatch, "SIMD and scalar rectangle masks match");
+	check(indicesMatch, "indices match the masks");
+
+	return test::report();
+}
\ No newline at end of file
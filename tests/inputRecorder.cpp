@@ -0,0 +1,180 @@
+///////////////////////////////////////////////////////////////////////////////
+/// Test of gs::input::InputRecorder and InputReplayer. Records 100 synthetic
+/// frames of input state and events, replays them and checks every field of
+/// every frame comes back the same.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+
+#include <Glass/glass.hpp>
+
+#include "test.hpp"
+
+using test::check;
+using gs::Vec2f;
+using gs::input::InputContext;
+using gs::input::InputEvent;
+
+namespace {
+	const char* path = "inputRecorder.glir";
+
+	/// Recorded input of one frame.
+	struct Frame {
+		InputContext::State state;
+		std::vector<InputEvent> events;
+	};
+
+	float randomFloat(std::mt19937& random) {
+		return std::uniform_real_distribution<float>(-5000.0f, 5000.0f)(random);
+	}
+	bool randomBool(std::mt19937& random) {
+		return random() % 2 == 0;
+	}
+
+	Frame randomFrame(std::mt19937& random, size_t index) {
+		Frame frame;
+		InputContext::State& state = frame.state;
+		state.defaultWindowSize = Vec2f(randomFloat(random), randomFloat(random));
+		state.mousePosition = Vec2f(randomFloat(random), randomFloat(random));
+		state.prvsMousePosition = Vec2f(randomFloat(random), randomFloat(random));
+		state.mouseChange = Vec2f(randomFloat(random), randomFloat(random));
+		state.activeMouseClickL = randomBool(random);
+		state.activeMouseClickM = randomBool(random);
+		state.activeMouseClickR = randomBool(random);
+		state.mouseClickL = randomBool(random);
+		state.mouseClickM = randomBool(random);
+		state.mouseClickR = randomBool(random);
+		state.space = randomBool(random);
+		state.backSpace = randomBool(random);
+		state.enter = randomBool(random);
+		// -1 is no text input.
+		state.textUnicode = randomBool(random) ? -1 : static_cast<int>(random() % 0x110000);
+		state.ticks = static_cast<int>(random() % 1000) - 500;
+
+		// Empty frames, ordinary frames and one burst.
+		const size_t count = index == 50 ? 600 : random() % 3 == 0 ? 0 : random() % 12;
+		for (size_t i = 0; i < count; i++) {
+			InputEvent event;
+			event.type = static_cast<InputEvent::Type>(random() % 5);
+			event.code = static_cast<std::uint32_t>(random());
+			event.position = Vec2f(randomFloat(random), randomFloat(random));
+			event.alt = randomBool(random);
+			event.control = randomBool(random);
+			event.shift = randomBool(random);
+			event.time = static_cast<long long>(random()) << 24 | random();
+			frame.events.push_back(event);
+		}
+		return frame;
+	}
+
+	bool same(Vec2f a, Vec2f b) {
+		return gs::input::priv::floatBits(a.x) == gs::input::priv::floatBits(b.x)
+			&& gs::input::priv::floatBits(a.y) == gs::input::priv::floatBits(b.y);
+	}
+	bool same(const InputContext::State& a, const InputContext::State& b) {
+		return a.window == b.window
+			&& same(a.defaultWindowSize, b.defaultWindowSize)
+			&& same(a.mousePosition, b.mousePosition)
+			&& same(a.prvsMousePosition, b.prvsMousePosition)
+			&& same(a.mouseChange, b.mouseChange)
+			&& a.activeMouseClickL == b.activeMouseClickL
+			&& a.activeMouseClickM == b.activeMouseClickM
+			&& a.activeMouseClickR == b.activeMouseClickR
+			&& a.mouseClickL == b.mouseClickL
+			&& a.mouseClickM == b.mouseClickM
+			&& a.mouseClickR == b.mouseClickR
+			&& a.space == b.space
+			&& a.backSpace == b.backSpace
+			&& a.enter == b.enter
+			&& a.textUnicode == b.textUnicode
+			&& a.ticks == b.ticks;
+	}
+	bool same(const InputEvent& a, const InputEvent& b) {
+		return a.type == b.type && a.code == b.code && same(a.position, b.position)
+			&& a.alt == b.alt && a.control == b.control && a.shift == b.shift
+			&& a.time == b.time;
+	}
+	/// @returns bool: True if the input globals match the frame.
+	bool matches(const Frame& frame) {
+		InputContext::State state;
+		InputContext::save(state);
+		if (!same(state, frame.state))
+			return false;
+
+		const gs::input::InputEventQueue& queue = gs::input::getEventQueue();
+		if (queue.size() != frame.events.size())
+			return false;
+
+		size_t i = 0;
+		for (const InputEvent& event : queue)
+			if (!same(event, frame.events[i++]))
+				return false;
+		return true;
+	}
+}
+
+int main() {
+	std::mt19937 random(20);
+	std::vector<Frame> frames;
+	for (size_t i = 0; i < 100; i++)
+		frames.push_back(randomFrame(random, i));
+
+	// The globals are changed inside an InputContext so the test
+	// doesn't depend on their starting values.
+	InputContext context;
+	context.apply([&]() {
+		gs::input::InputRecorder recorder;
+		check(recorder.open(path), "recording opens");
+
+		for (const Frame& frame : frames) {
+			// Not beginFrame(), updateInputs() would change the state.
+			InputContext::load(frame.state);
+			gs::input::getEventQueue().clear();
+			for (const InputEvent& event : frame.events)
+				gs::input::getEventQueue().push(event);
+			recorder.recordFrame();
+		}
+		check(recorder.getFrameCount() == frames.size(), "recorder counts every frame");
+		recorder.close();
+
+		gs::input::InputReplayer replayer;
+		check(replayer.open(path), "recording loads");
+		check(replayer.getFrameCount() == frames.size(), "every frame is loaded");
+
+		bool allMatch = true;
+		for (const Frame& frame : frames)
+			allMatch &= replayer.nextFrame() && matches(frame);
+		check(allMatch, "every field of every frame is replayed");
+		check(!replayer.nextFrame(), "replay ends after the last frame");
+
+		replayer.rewind();
+		check(replayer.nextFrame() && matches(frames[0]), "rewind replays the first frame");
+
+		size_t updates = 0;
+		const gs::input::ReplayBenchmark result = gs::input::benchmarkReplay(
+			replayer, [&updates]() { updates++; }, 3);
+		check(result.frames == frames.size() * 3 && updates == result.frames,
+			"benchmarkReplay updates every frame of every repeat");
+	});
+
+	// A recording cut off in the middle of a frame keeps the
+	// frames before it.
+	std::vector<char> bytes;
+	{
+		std::ifstream file(path, std::ios::binary);
+		bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	}
+	{
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		file.write(bytes.data(), static_cast<std::streamsize>(bytes.size() - 3));
+	}
+	gs::input::InputReplayer truncated;
+	check(truncated.open(path) && truncated.getFrameCount() == frames.size() - 1,
+		"a cut off frame is dropped");
+
+	std::remove(path);
+	return test::report();
+}
\ No newline at end of file
@@ -0,0 +1,68 @@
+///////////////////////////////////////////////////////////////////////////////
+/// Test of gs::util::PrecisionClock. Paces three seconds of frames at 144 Hz
+/// with some work in every frame and checks the pacing error stays under
+/// 0.2 milliseconds and the frames don't drift from the target rate.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+
+#include <Glass/glass.hpp>
+
+#include "test.hpp"
+
+using test::check;
+
+namespace {
+	typedef std::chrono::steady_clock SteadyClock;
+
+	/// Busy waits like a frame that does work.
+	void work(float milliseconds) {
+		const SteadyClock::time_point end = SteadyClock::now()
+			+ std::chrono::duration_cast<SteadyClock::duration>(
+				std::chrono::duration<float, std::milli>(milliseconds));
+		while (SteadyClock::now() < end) {
+		}
+	}
+}
+
+int main() {
+	const unsigned int framerate = 144;
+	const size_t frames = framerate * 3;
+	const float period = 1000.0f / framerate;
+
+	gs::util::PrecisionClock clock;
+
+	// The first frame schedules the deadlines, the error is only
+	// measured from there.
+	clock.begin();
+	clock.end();
+	clock.wait(framerate);
+	clock.resetPacingError();
+	const SteadyClock::time_point start = SteadyClock::now();
+
+	for (size_t i = 0; i < frames; i++) {
+		clock.begin();
+		// Uneven work like a real frame.
+		work(1.0f + (i % 4) * 0.5f);
+		clock.end();
+		clock.wait(framerate);
+	}
+
+	const float elapsed = std::chrono::duration<float, std::milli>(
+		SteadyClock::now() - start).count();
+	const float drift = elapsed - period * frames;
+
+	std::cout << "Average pacing error: " << clock.getAveragePacingError() << " ms" << std::endl;
+	std::cout << "Max pacing error: " << clock.getMaxPacingError() << " ms" << std::endl;
+	std::cout << "Drift over " << frames << " frames: " << drift << " ms" << std::endl;
+
+	check(clock.getAveragePacingError() < 0.2f, "average pacing error is under 0.2 ms");
+	check(clock.getAveragePacingError() >= 0.0f, "wait() doesn't return before the deadline");
+	// The drift is at most the error of the last frame if no
+	// deadline was missed.
+	check(std::abs(drift) < 1.0f, "frames don't drift from 144 Hz");
+	check(std::abs(clock.getFrameTimes().getMean() - period) < 0.1f,
+		"average frame time is one period");
+
+	return test::report();
+}
\ No newline at end of file
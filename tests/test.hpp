@@ -0,0 +1,34 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////
+/// Checks shared by the Glass tests. Every test is its own program and
+/// returns test::report() from main() so ctest sees a failed check.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+
+namespace test {
+	/// Number of failed checks.
+	inline int failures = 0;
+
+	///////////////////////////////////////////////////////////
+	/// Method check() will print the message if the condition
+	/// is false and count the failure.
+	/// @param bool condition: Checked condition.
+	/// @param const char* message: What was expected.
+	///////////////////////////////////////////////////////////
+	inline void check(bool condition, const char* message) {
+		if (!condition) {
+			std::cout << "FAILED: " << message << std::endl;
+			failures++;
+		}
+	}
+	///////////////////////////////////////////////////////////
+	/// Method report() will print the result of the test.
+	/// @returns int: Exit code, 0 if every check passed.
+	///////////////////////////////////////////////////////////
+	inline int report() {
+		std::cout << (failures == 0 ? "PASSED" : "FAILED") << std::endl;
+		return failures == 0 ? 0 : 1;
+	}
+}
\ No newline at end of file
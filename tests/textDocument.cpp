@@ -0,0 +1,150 @@
+///////////////////////////////////////////////////////////////////////////////
+/// Test of gs::util::TextDocument. Applies random edits and cursor moves to a
+/// TextDocument and to a std::string and checks that the text, cursor and
+/// line index always agree.
+///////////////////////////////////////////////////////////////////////////////
+
+#include <random>
+
+#include <Glass/glass.hpp>
+
+#include "test.hpp"
+
+using test::check;
+
+namespace {
+	/// std::string with a cursor, the reference for TextDocument.
+	struct Model {
+		std::string text;
+		size_t cursor = 0;
+
+		size_t lineCount() const {
+			size_t count = 1;
+			for (char character : text)
+				count += character == '\n';
+			return count;
+		}
+		size_t lineOf(size_t position) const {
+			size_t line = 0;
+			for (size_t i = 0; i < position; i++)
+				line += text[i] == '\n';
+			return line;
+		}
+	};
+
+	/// Random text with plenty of newlines.
+	std::string randomString(std::mt19937& random, size_t maxLength) {
+		const char characters[] = "ab \n";
+		std::string string(random() % (maxLength + 1), ' ');
+		for (char& character : string)
+			character = characters[random() % 4];
+		return string;
+	}
+
+	/// @returns bool: True if the cheap state matches.
+	bool sameCursor(const gs::util::TextDocument& document, const Model& model) {
+		return document.size() == model.text.size() && document.getCursor() == model.cursor;
+	}
+	/// @returns bool: True if the text and line index match.
+	bool sameText(const gs::util::TextDocument& document, const Model& model) {
+		if (document.getString() != model.text || document.getLineCount() != model.lineCount())
+			return false;
+
+		for (size_t i = 0; i < model.text.size(); i++)
+			if (document[i] != model.text[i])
+				return false;
+
+		std::string line;
+		size_t start = 0;
+		for (size_t i = 0; i < document.getLineCount(); i++) {
+			size_t end = model.text.find('\n', start);
+			if (end == std::string::npos)
+				end = model.text.size();
+
+			document.getLine(i, line);
+			if (document.getLineStart(i) != start || document.getLineEnd(i) != end
+				|| line != model.text.substr(start, end - start))
+				return false;
+			start = end + 1;
+		}
+
+		for (size_t i = 0; i <= model.text.size(); i++)
+			if (document.getLineOf(i) != model.lineOf(i))
+				return false;
+		return true;
+	}
+}
+
+int main() {
+	std::mt19937 random(1234);
+	gs::util::TextDocument document;
+	Model model;
+
+	bool cursorMatches = true, textMatches = true;
+
+	for (int step = 0; step < 20000 && cursorMatches && textMatches; step++) {
+		switch (random() % 8) {
+		case 0:
+		case 1: {
+			const char character = "xy\n"[random() % 3];
+			document.insert(character);
+			model.text.insert(model.cursor, 1, character);
+			model.cursor++;
+			break;
+		}
+		case 2: {
+			const std::string string = randomString(random, 12);
+			document.insert(string);
+			model.text.insert(model.cursor, string);
+			model.cursor += string.size();
+			break;
+		}
+		case 3: {
+			const size_t count = random() % 5;
+			const size_t removed = std::min(count, model.cursor);
+			cursorMatches &= document.eraseBefore(count) == removed;
+			model.cursor -= removed;
+			model.text.erase(model.cursor, removed);
+			break;
+		}
+		case 4: {
+			const size_t count = random() % 5;
+			const size_t removed = std::min(count, model.text.size() - model.cursor);
+			cursorMatches &= document.eraseAfter(count) == removed;
+			model.text.erase(model.cursor, removed);
+			break;
+		}
+		case 5:
+		case 6: {
+			// Past the end is clamped.
+			const size_t position = random() % (model.text.size() + 3);
+			document.setCursor(position);
+			model.cursor = std::min(position, model.text.size());
+			break;
+		}
+		default:
+			if (random() % 50 == 0) {
+				const std::string string = randomString(random, 200);
+				document.setString(string);
+				model.text = string;
+				model.cursor = string.size();
+			}
+			else if (random() % 200 == 0) {
+				document.clear();
+				model.text.clear();
+				model.cursor = 0;
+			}
+			break;
+		}
+
+		cursorMatches &= sameCursor(document, model);
+		if (step % 64 == 0)
+			textMatches &= sameText(document, model);
+	}
+	textMatches &= sameText(document, model);
+
+	check(cursorMatches, "size, cursor and erase counts match std::string");
+	check(textMatches, "text and lines match std::string");
+
+	return test::report();
+}
\ No newline at end of file